@@ -58,6 +58,7 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_scrollbar(lv_obj_t * obj, const lv_area_t * clip_area);
 static lv_res_t scrollbar_init_draw_dsc(lv_obj_t * obj, lv_draw_rect_dsc_t * dsc);
 static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_find);
+static bool obj_affects_parent_scrollbars(const lv_obj_t * obj);
 static void lv_obj_set_state(lv_obj_t * obj, lv_state_t new_state);
 
 /**********************
@@ -205,13 +206,20 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     bool was_on_layout = lv_obj_is_layout_positioned(obj);
 
+    /*A hidden object doesn't count in the scrollable area of its parent,
+     *so hiding an object which is out of the parent changes the parent's scrollbars*/
+    bool scrollbar_changes = (f & LV_OBJ_FLAG_HIDDEN) && !lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) &&
+                             obj_affects_parent_scrollbars(obj);
+
     if(f & LV_OBJ_FLAG_HIDDEN) lv_obj_invalidate(obj);
+    if(scrollbar_changes) lv_obj_scrollbar_invalidate(obj->parent);
 
     obj->flags |= f;
 
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
     }
+    if(scrollbar_changes) lv_obj_scrollbar_invalidate(obj->parent);
 
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
@@ -224,6 +232,11 @@ void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     bool was_on_layout = lv_obj_is_layout_positioned(obj);
 
+    /*Showing an object which is out of the parent changes the parent's scrollbars*/
+    bool scrollbar_changes = (f & LV_OBJ_FLAG_HIDDEN) && lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN) &&
+                             obj_affects_parent_scrollbars(obj);
+    if(scrollbar_changes) lv_obj_scrollbar_invalidate(obj->parent);
+
     obj->flags &= (~f);
 
     if(f & LV_OBJ_FLAG_HIDDEN) {
@@ -232,6 +245,7 @@ void lv_obj_clear_flag(lv_obj_t * obj, lv_obj_flag_t f)
             lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
         }
     }
+    if(scrollbar_changes) lv_obj_scrollbar_invalidate(obj->parent);
 
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
@@ -700,11 +714,7 @@ static void lv_obj_event(const lv_obj_class_t * class_p, lv_event_t * e)
             lv_obj_mark_layout_as_dirty(obj);
         }
 
-        uint32_t i;
-        for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
-            lv_obj_t * child = lv_obj_get_child(obj, i);
-            lv_obj_mark_layout_as_dirty(child);
-        }
+        _lv_obj_mark_children_layout_on_resize(obj);
     }
     else if(code == LV_EVENT_CHILD_CHANGED) {
         lv_coord_t w = lv_obj_get_style_width(obj, LV_PART_MAIN);
@@ -829,3 +839,18 @@ static bool obj_valid_child(const lv_obj_t * parent, const lv_obj_t * obj_to_fin
     }
     return false;
 }
+
+/**
+ * The scrollbars of the parent depend on the object if it's out of the parent
+ * or the parent is scrolled (then the scrolled out part is in the scrollbars too)
+ */
+static bool obj_affects_parent_scrollbars(const lv_obj_t * obj)
+{
+    lv_obj_t * parent = obj->parent;
+    if(parent == NULL) return false;
+    if(lv_obj_get_scroll_x(parent) || lv_obj_get_scroll_y(parent)) return true;
+
+    lv_area_t parent_fit_area;
+    lv_obj_get_content_coords(parent, &parent_fit_area);
+    return !_lv_area_is_in(&obj->coords, &parent_fit_area, 0);
+}
@@ -161,12 +161,16 @@ typedef struct _lv_obj_t {
     _lv_obj_style_t * styles;
 #if LV_USE_USER_DATA
     void * user_data;
+#endif
+#if LV_STYLE_CACHE_SIZE
+    uint32_t style_stamp;   /*The cached style properties are valid only with this stamp*/
 #endif
     lv_area_t coords;
     lv_obj_flag_t flags;
     lv_state_t state;
     uint16_t layout_inv :1;
     uint16_t scr_layout_inv :1;
+    uint16_t child_layout_inv :1;   /*A descendant's layout is dirty*/
     uint16_t skip_trans :1;
     uint16_t style_cnt  :6;
     uint16_t h_layout   :1;
@@ -49,6 +49,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
     lv_memset_00(obj, s);
     obj->class_p = class_p;
     obj->parent = parent;
+    _lv_obj_style_cache_invalidate(obj); /*Don't use the cached properties of a deleted object from this address*/
 
     /*Create a screen*/
     if(parent == NULL) {
@@ -25,11 +25,13 @@
  **********************/
 static void calc_auto_size(lv_obj_t * obj, lv_coord_t * w_out, lv_coord_t * h_out);
 static void layout_update_core(lv_obj_t * obj);
+static bool depends_on_parent_size(lv_obj_t * obj);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 static uint32_t layout_cnt;
+static lv_layout_stats_t layout_stats;
 
 /**********************
  *      MACROS
@@ -162,21 +164,28 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_area_t parent_fit_area;
     lv_obj_get_content_coords(parent, &parent_fit_area);
 
-    /*If the object is already out of the parent and its position is changes
-     *surely the scrollbars also changes so invalidate them*/
-    bool on1 = _lv_area_is_in(&ori, &parent_fit_area, 0);
-    if(!on1) lv_obj_scrollbar_invalidate(parent);
-
     /*Set the length and height
      *Be sure the content is not scrolled in an invalid position on the new size*/
-    obj->coords.y2 = obj->coords.y1 + h - 1;
+    lv_area_t new_coords;
+    lv_area_copy(&new_coords, &ori);
+    new_coords.y2 = new_coords.y1 + h - 1;
     if(lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL) {
-        obj->coords.x1 = obj->coords.x2 - w + 1;
+        new_coords.x1 = new_coords.x2 - w + 1;
     }
     else {
-        obj->coords.x2 = obj->coords.x1 + w - 1;
+        new_coords.x2 = new_coords.x1 + w - 1;
     }
 
+    /*An object inside a not scrolled parent doesn't affect the parent's scrollbars. If it's out of
+     *the parent before or after the change the scrollbars change, so invalidate them in both states.
+     *In a scrolled parent the scrolled out part is also in the scrollbars, so always invalidate them.*/
+    bool on1 = _lv_area_is_in(&ori, &parent_fit_area, 0);
+    bool on2 = _lv_area_is_in(&new_coords, &parent_fit_area, 0);
+    bool scrollbar_changes = !on1 || !on2 || lv_obj_get_scroll_x(parent) || lv_obj_get_scroll_y(parent);
+    if(scrollbar_changes) lv_obj_scrollbar_invalidate(parent);
+
+    lv_area_copy(&obj->coords, &new_coords);
+
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_event_send(obj, LV_EVENT_SIZE_CHANGED, &ori);
 
@@ -188,10 +197,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
 
     lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
 
-    /*If the object was out of the parent invalidate the new scrollbar area too.
-     *If it wasn't out of the parent but out now, also invalidate the srollbars*/
-    bool on2 = _lv_area_is_in(&obj->coords, &parent_fit_area, 0);
-    if(on1 || (!on1 && on2)) lv_obj_scrollbar_invalidate(parent);
+    if(scrollbar_changes) lv_obj_scrollbar_invalidate(parent);
 
 
 
@@ -277,13 +283,19 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
 
+    /*Mark the parents to show the way to this object. This way the clean subtrees can be skipped*/
+    lv_obj_t * scr = obj;
+    while(scr->parent) {
+        scr = scr->parent;
+        scr->child_layout_inv = 1;
+    }
+
     /*Mark the screen as dirty too to mark that there is an something to do on this screen*/
-    lv_obj_t * scr = lv_obj_get_screen(obj);
     scr->scr_layout_inv = 1;
 
     /*Make the display refreshing*/
     lv_disp_t * disp = lv_obj_get_disp(scr);
-    lv_timer_resume(disp->refr_timer);
+    _lv_refr_schedule(disp);
 }
 
 void lv_obj_update_layout(const lv_obj_t * obj)
@@ -301,6 +313,7 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     while(scr->scr_layout_inv) {
         LV_LOG_INFO("Layout update begin")
         scr->scr_layout_inv = 0;
+        layout_stats.passes++;
         layout_update_core(scr);
         LV_LOG_TRACE("Layout update end")
     }
@@ -319,6 +332,24 @@ uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data)
     return layout_cnt;  /*No -1 to skip 0th index*/
 }
 
+void lv_layout_get_stats(lv_layout_stats_t * stats)
+{
+    *stats = layout_stats;
+}
+
+void _lv_obj_mark_children_layout_on_resize(lv_obj_t * obj)
+{
+    /*In RTL the right side is kept on resize so all children need to be moved*/
+    bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL ? true : false;
+
+    uint32_t i;
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+        lv_obj_t * child = lv_obj_get_child(obj, i);
+        if(rtl || depends_on_parent_size(child)) lv_obj_mark_layout_as_dirty(child);
+        else layout_stats.skipped++;
+    }
+}
+
 void lv_obj_set_align(lv_obj_t * obj, lv_align_t align)
 {
     lv_obj_set_style_align(obj, align, 0);
@@ -716,16 +747,22 @@ void lv_obj_move_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     lv_area_t ori;
     lv_obj_get_coords(obj, &ori);
 
-    /*Check if the object inside the parent or not*/
-    lv_area_t parent_fit_area;
-    bool on1 = false;
+    /*An object inside a not scrolled parent doesn't affect the parent's scrollbars. If it's out of
+     *the parent before or after the move the scrollbars change, so invalidate them in both positions.
+     *In a scrolled parent the scrolled out part is also in the scrollbars, so always invalidate them.*/
+    bool scrollbar_changes = false;
     if(parent) {
+        lv_area_t parent_fit_area;
         lv_obj_get_content_coords(parent, &parent_fit_area);
 
-        /*If the object is already out of the parent and its position is changes
-         *surely the scrollbars also changes so invalidate them*/
-        on1 = _lv_area_is_in(&ori, &parent_fit_area, 0);
-        if(!on1) lv_obj_scrollbar_invalidate(parent);
+        lv_area_t new_coords;
+        lv_area_copy(&new_coords, &ori);
+        lv_area_move(&new_coords, diff.x, diff.y);
+
+        scrollbar_changes = !_lv_area_is_in(&ori, &parent_fit_area, 0) ||
+                            !_lv_area_is_in(&new_coords, &parent_fit_area, 0) ||
+                            lv_obj_get_scroll_x(parent) || lv_obj_get_scroll_y(parent);
+        if(scrollbar_changes) lv_obj_scrollbar_invalidate(parent);
     }
 
     obj->coords.x1 += diff.x;
@@ -741,12 +778,7 @@ void lv_obj_move_to(lv_obj_t * obj, lv_coord_t x, lv_coord_t y)
     /*Invalidate the new area*/
     lv_obj_invalidate(obj);
 
-    /*If the object was out of the parent invalidate the new scrollbar area too.
-     *If it wasn't out of the parent but out now, also invalidate the srollbars*/
-    if(parent) {
-        bool on2 = _lv_area_is_in(&obj->coords, &parent_fit_area, 0);
-        if(on1 || (!on1 && on2)) lv_obj_scrollbar_invalidate(parent);
-    }
+    if(scrollbar_changes) lv_obj_scrollbar_invalidate(parent);
 }
 
 void lv_obj_move_children_by(lv_obj_t * obj, lv_coord_t x_diff, lv_coord_t y_diff, bool ignore_floating)
@@ -933,15 +965,20 @@ static void calc_auto_size(lv_obj_t * obj, lv_coord_t * w_out, lv_coord_t * h_ou
 
 static void layout_update_core(lv_obj_t * obj)
 {
-    uint32_t i;
-    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
-        lv_obj_t * child = lv_obj_get_child(obj, i);
-        layout_update_core(child);
+    /*Go only into the subtrees with a dirty object*/
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        uint32_t i;
+        for(i = 0; i < lv_obj_get_child_cnt(obj); i++) {
+            lv_obj_t * child = lv_obj_get_child(obj, i);
+            if(child->layout_inv || child->child_layout_inv) layout_update_core(child);
+        }
     }
 
     if(obj->layout_inv == 0) return;
 
     obj->layout_inv = 0;
+    layout_stats.objs++;
 
     lv_obj_refr_size(obj);
     lv_obj_refr_pos(obj);
@@ -951,6 +988,29 @@ static void layout_update_core(lv_obj_t * obj)
         if(layout_id > 0 && layout_id <= layout_cnt) {
             void  * user_data = LV_GC_ROOT(_lv_layout_list)[layout_id -1].user_data;
             LV_GC_ROOT(_lv_layout_list)[layout_id -1].cb(obj, user_data);
+            layout_stats.runs++;
         }
     }
 }
+
+/**
+ * Tell whether the size or the position of an object is calculated from the size of its parent
+ * @param obj       pointer to an object
+ * @return          true: the object has to be refreshed when its parent is resized
+ */
+static bool depends_on_parent_size(lv_obj_t * obj)
+{
+    lv_align_t align = lv_obj_get_style_align(obj, LV_PART_MAIN);
+    if(align != LV_ALIGN_DEFAULT && align != LV_ALIGN_TOP_LEFT) return true;
+
+    if(LV_COORD_IS_PCT(lv_obj_get_style_width(obj, LV_PART_MAIN))) return true;
+    if(LV_COORD_IS_PCT(lv_obj_get_style_height(obj, LV_PART_MAIN))) return true;
+    if(LV_COORD_IS_PCT(lv_obj_get_style_min_width(obj, LV_PART_MAIN))) return true;
+    if(LV_COORD_IS_PCT(lv_obj_get_style_max_width(obj, LV_PART_MAIN))) return true;
+    if(LV_COORD_IS_PCT(lv_obj_get_style_min_height(obj, LV_PART_MAIN))) return true;
+    if(LV_COORD_IS_PCT(lv_obj_get_style_max_height(obj, LV_PART_MAIN))) return true;
+    if(LV_COORD_IS_PCT(lv_obj_get_style_x(obj, LV_PART_MAIN))) return true;
+    if(LV_COORD_IS_PCT(lv_obj_get_style_y(obj, LV_PART_MAIN))) return true;
+
+    return false;
+}
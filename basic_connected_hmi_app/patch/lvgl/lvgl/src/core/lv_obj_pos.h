@@ -30,6 +30,16 @@ typedef struct {
     void * user_data;
 }lv_layout_dsc_t;
 
+/**
+ * Counters of the layout updates since start-up
+ */
+typedef struct {
+    uint32_t passes;    /**< Number of times the dirty objects of a screen were updated*/
+    uint32_t objs;      /**< Number of objects whose size and position were refreshed*/
+    uint32_t runs;      /**< Number of times a layout (e.g. flex or grid) arranged the children of an object*/
+    uint32_t skipped;   /**< Number of children left untouched when their parent was resized as they don't depend on its size*/
+} lv_layout_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -148,6 +158,19 @@ void lv_obj_update_layout(const struct _lv_obj_t * obj);
  */
 uint32_t lv_layout_register(lv_layout_update_cb_t cb, void * user_data);
 
+/**
+ * Get the layout update counters
+ * @param stats     pointer to a variable to store the result
+ */
+void lv_layout_get_stats(lv_layout_stats_t * stats);
+
+/**
+ * Called when the size of an object has changed to mark the children whose size or position
+ * depends on the parent's size. The other children are not updated.
+ * @param obj       pointer to an object whose size has changed
+ */
+void _lv_obj_mark_children_layout_on_resize(struct _lv_obj_t * obj);
+
 /**
  * Change the alignment of an object.
  * @param obj       pointer to an object to align
@@ -15,6 +15,10 @@
  *********************/
 #define MY_CLASS &lv_obj_class
 
+#if LV_STYLE_CACHE_SIZE == 1 || (LV_STYLE_CACHE_SIZE & (LV_STYLE_CACHE_SIZE - 1))
+#error "LV_STYLE_CACHE_SIZE must be a power of 2 and at least 2"
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +39,19 @@ typedef enum {
     CACHE_NEED_CHECK = 4,
 }cache_t;
 
+#if LV_STYLE_CACHE_SIZE
+/*The result of `get_prop_core` for an object's part, property and state*/
+typedef struct {
+    const lv_obj_t * obj;
+    uint32_t stamp;         /*`obj->style_stamp` when the entry was saved*/
+    lv_style_value_t value;
+    uint16_t prop;
+    lv_state_t state;
+    uint8_t part;           /*The part shifted to 0..255*/
+    uint8_t found;
+} style_cache_entry_t;
+#endif
+
 /**********************
  *  GLOBAL PROTOTYPES
  **********************/
@@ -44,6 +61,7 @@ typedef enum {
  **********************/
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
+static bool get_prop_cached(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
 static bool get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
 static lv_style_value_t apply_color_filter(const lv_obj_t * obj, uint32_t part, lv_style_value_t v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
@@ -59,6 +77,12 @@ static void fade_in_anim_ready(lv_anim_t * a);
  *  STATIC VARIABLES
  **********************/
 static bool style_refr = true;
+static lv_obj_style_stats_t style_stats;
+
+#if LV_STYLE_CACHE_SIZE
+    static style_cache_entry_t style_cache[LV_STYLE_CACHE_SIZE];
+    static uint32_t style_cache_stamp;
+#endif
 
 /**********************
  *      MACROS
@@ -146,6 +170,7 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
         /*The style from the current `i` index is removed, so `i` points to the next style.
          *Therefore it doesn't needs to be incremented*/
     }
+    if(deleted) _lv_obj_style_cache_invalidate(obj);
     if(deleted && prop != LV_STYLE_PROP_INV) {
         lv_obj_refresh_style(obj, part, prop);
     }
@@ -153,6 +178,10 @@ void lv_obj_remove_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+#if LV_STYLE_CACHE_SIZE
+    /*The objects won't be refreshed so forget all cached properties*/
+    if(!style_refr) lv_memset_00(style_cache, sizeof(style_cache));
+#endif
     if(!style_refr) return;
     lv_disp_t * d = lv_disp_get_next(NULL);
 
@@ -169,6 +198,8 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    _lv_obj_style_cache_invalidate(obj);
+
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -212,8 +243,9 @@ lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_
         prop &= ~LV_STYLE_PROP_FILTER;
     }
     bool found = false;
+    style_stats.lookups++;
     while(obj) {
-        found = get_prop_core(obj, part, prop, &value_act);
+        found = get_prop_cached(obj, part, prop, &value_act);
         if(found) break;
         if(!inherit) break;
 
@@ -286,6 +318,7 @@ bool lv_obj_remove_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_sty
     /*The style is not found*/
     if(i == obj->style_cnt) return false;
 
+    _lv_obj_style_cache_invalidate(obj);
     return lv_style_remove_prop(obj->styles[i].style, prop);
 }
 
@@ -308,6 +341,7 @@ void _lv_obj_style_create_transition(lv_obj_t * obj, lv_part_t part, lv_state_t
 
     _lv_obj_style_t * style_trans = get_trans_style(obj, part);
     lv_style_set_prop(style_trans->style, tr_dsc->prop, v1);   /*Be sure `trans_style` has a valid value*/
+    _lv_obj_style_cache_invalidate(obj);
 
     if(tr_dsc->prop == LV_STYLE_RADIUS) {
         if(v1.num == LV_RADIUS_CIRCLE || v2.num == LV_RADIUS_CIRCLE) {
@@ -449,6 +483,22 @@ lv_part_t lv_obj_style_get_selector_part(lv_style_selector_t selector)
     return selector & 0xFF0000;
 }
 
+void _lv_obj_style_cache_invalidate(lv_obj_t * obj)
+{
+#if LV_STYLE_CACHE_SIZE
+    /*The entries of the object are not searched, they will just not match the new stamp*/
+    style_cache_stamp++;
+    obj->style_stamp = style_cache_stamp;
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
+void lv_obj_style_get_stats(lv_obj_style_stats_t * stats)
+{
+    *stats = style_stats;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -525,8 +575,61 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
 }
 
 
+/**
+ * Get a property of an object's part from the style cache or walk the styles if it's not cached.
+ * @param obj   pointer to an object
+ * @param part  the part whose property should be get
+ * @param prop  the property to get
+ * @param v     store the value here if found
+ * @return      true: the property is set in the styles of `obj`
+ */
+static bool get_prop_cached(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
+{
+#if LV_STYLE_CACHE_SIZE
+    /*The transitions are skipped only temporarily, don't remember these values*/
+    if(obj->skip_trans) return get_prop_core(obj, part, prop, v);
+
+    uint8_t part_id = part >> 16;
+    lv_state_t state = obj->state;
+    uint32_t h = (uint32_t)((lv_uintptr_t)obj >> 2) * 2654435761U;
+    h ^= ((uint32_t)prop << 5) ^ ((uint32_t)part_id << 13) ^ state;
+
+    /*2 way set associative: the most recently used entry of the set is the first*/
+    style_cache_entry_t * e = &style_cache[((h ^ (h >> 16)) & (LV_STYLE_CACHE_SIZE / 2 - 1)) * 2];
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        if(e[i].obj == obj && e[i].stamp == obj->style_stamp && e[i].prop == prop && e[i].part == part_id &&
+           e[i].state == state) {
+            style_stats.hits++;
+            if(i != 0) {
+                style_cache_entry_t tmp = e[0];
+                e[0] = e[1];
+                e[1] = tmp;
+            }
+            if(e->found) *v = e->value;
+            return e->found;
+        }
+    }
+
+    bool found = get_prop_core(obj, part, prop, v);
+    e[1] = e[0];
+    e->obj = obj;
+    e->stamp = obj->style_stamp;
+    e->prop = prop;
+    e->part = part_id;
+    e->state = state;
+    e->found = found;
+    if(found) e->value = *v;
+    return found;
+#else
+    return get_prop_core(obj, part, prop, v);
+#endif
+}
+
 static bool get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
 {
+    style_stats.walks++;
+
     uint8_t group = 1 << _lv_style_get_prop_group(prop);
     int32_t weight = -1;
     lv_state_t state = obj->state;
@@ -664,6 +767,7 @@ static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, tran
             for(i = 0; i < obj->style_cnt; i++) {
                 if(obj->styles[i].is_trans && (part == LV_PART_ANY || obj->styles[i].selector == part)) {
                     lv_style_remove_prop(obj->styles[i].style, tr->prop);
+                    _lv_obj_style_cache_invalidate(obj);
                     lv_anim_del(tr, NULL);
                     _lv_ll_remove(&LV_GC_ROOT(_lv_obj_style_trans_ll), tr);
                     lv_mem_free(tr);
@@ -757,6 +861,7 @@ static void trans_anim_start_cb(lv_anim_t * a)
 
     _lv_obj_style_t * style_trans = get_trans_style(tr->obj, tr->selector);
     lv_style_set_prop(style_trans->style, tr->prop, tr->start_value);   /*Be sure `trans_style` has a valid value*/
+    _lv_obj_style_cache_invalidate(tr->obj);
 
 }
 
@@ -787,6 +892,7 @@ static void trans_anim_ready_cb(lv_anim_t * a)
 
                 _lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop(obj_style->style, prop);
+                _lv_obj_style_cache_invalidate(obj);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, obj_style->style, obj_style->selector);
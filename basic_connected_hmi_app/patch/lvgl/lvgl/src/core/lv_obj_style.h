@@ -54,6 +54,15 @@ typedef struct {
 #endif
 }_lv_obj_style_transition_dsc_t;
 
+/**
+ * Counters of the style property lookups since start-up
+ */
+typedef struct {
+    uint32_t lookups;   /**< Number of `lv_obj_get_style_prop()` calls*/
+    uint32_t walks;     /**< Number of times the styles of an object were searched for a property*/
+    uint32_t hits;      /**< Number of times the style cache could answer instead of a walk*/
+} lv_obj_style_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -171,6 +180,19 @@ void _lv_obj_style_create_transition(struct _lv_obj_t * obj, lv_part_t part, lv_
  */
 _lv_style_state_cmp_t _lv_obj_style_state_compare(struct _lv_obj_t * obj, lv_state_t state1, lv_state_t state2);
 
+/**
+ * Used internally to forget the cached style properties of an object.
+ * Called when the styles of the object change and for new objects.
+ * @param obj       pointer to an object
+ */
+void _lv_obj_style_cache_invalidate(struct _lv_obj_t * obj);
+
+/**
+ * Get the style property lookup counters
+ * @param stats     pointer to a variable to store the result
+ */
+void lv_obj_style_get_stats(lv_obj_style_stats_t * stats);
+
 /**
  * Fade in an an object and all its children.
  * @param obj       the object to fade in
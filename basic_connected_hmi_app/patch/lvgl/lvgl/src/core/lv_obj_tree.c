@@ -165,6 +165,9 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+    /*The new parent might have a different size and the dirty children have to be found from the new parent*/
+    lv_obj_mark_layout_as_dirty(obj);
+
     if(new_base_dir != LV_BASE_DIR_RTL) {
         lv_obj_set_pos(obj, old_pos.x, old_pos.y);
     }
@@ -12,6 +12,7 @@
 #include "../hal/lv_hal_tick.h"
 #include "../hal/lv_hal_disp.h"
 #include "../misc/lv_timer.h"
+#include "../misc/lv_anim.h"
 #include "../misc/lv_mem.h"
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
@@ -22,6 +23,10 @@
     #include "../widgets/lv_label.h"
 #endif
 
+#if LV_USE_GPU_NXP_PXP
+    #include "../gpu/lv_gpu_nxp_pxp.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -34,13 +39,15 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void lv_refr_sync_areas(void);
+static void lv_refr_save_sync_areas(void);
 static void lv_refr_areas(void);
 static void lv_refr_area(const lv_area_t * area_p);
 static void lv_refr_area_part(const lv_area_t * area_p);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
-static void draw_buf_flush(void);
+static void draw_buf_flush(const lv_area_t * flush_area);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
 
 /**********************
@@ -48,6 +55,7 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  **********************/
 static uint32_t px_num;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
+static uint32_t anim_refr_cnt;
 #if LV_USE_PERF_MONITOR
     static uint32_t fps_sum_cnt;
     static uint32_t fps_sum_all;
@@ -127,11 +135,18 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     suc = _lv_area_intersect(&com_area, area_p, &scr_area);
     if(suc == false)  return; /*Out of the screen*/
 
+    /*An animation which declared the area it changes can't invalidate anything else*/
+    const lv_area_t * anim_area = _lv_anim_get_inv_area();
+    if(anim_area) {
+        suc = _lv_area_intersect(&com_area, &com_area, anim_area);
+        if(suc == false) return;
+    }
+
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->driver->full_refresh) {
         disp->inv_areas[0] = scr_area;
         disp->inv_p = 1;
-        lv_timer_resume(disp->refr_timer);
+        _lv_refr_schedule(disp);
         return;
     }
 
@@ -140,7 +155,10 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
     /*Save only if this area is not in one of the saved areas*/
     uint16_t i;
     for(i = 0; i < disp->inv_p; i++) {
-        if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
+        if(_lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) {
+            _lv_refr_schedule(disp);  /*The area is already saved but it might be an animation's change now*/
+            return;
+        }
     }
 
     /*Save the area*/
@@ -152,6 +170,18 @@ void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p)
         lv_area_copy(&disp->inv_areas[disp->inv_p], &scr_area);
     }
     disp->inv_p++;
+    _lv_refr_schedule(disp);
+}
+
+/**
+ * Schedule the refresh of a display because something changed on it.
+ * The changes made while an animation step is applied are drawn by the same refresh
+ * which is counted as an animation driven refresh.
+ * @param disp pointer to the display
+ */
+void _lv_refr_schedule(lv_disp_t * disp)
+{
+    if(_lv_anim_is_stepping()) disp->inv_by_anim = 1;
     lv_timer_resume(disp->refr_timer);
 }
 
@@ -206,6 +236,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+        disp_refr->inv_by_anim = 0;
         LV_LOG_WARN("there is no active screen");
         TRACE_REFR("finished");
         return;
@@ -213,12 +244,21 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
 
     lv_refr_join_area();
 
+    /*In double buffered direct mode bring the draw buffer up to date with the displayed one*/
+    if(disp_refr->inv_p != 0 && disp_refr->driver->direct_mode && disp_refr->driver->draw_buf->buf2) {
+        lv_refr_sync_areas();
+    }
+
     lv_refr_areas();
 
     /*If refresh happened ...*/
     if(disp_refr->inv_p != 0) {
         if(disp_refr->driver->full_refresh) {
-            draw_buf_flush();
+            draw_buf_flush(&disp_refr->driver->draw_buf->area);
+        }
+
+        if(disp_refr->driver->direct_mode && disp_refr->driver->draw_buf->buf2) {
+            lv_refr_save_sync_areas();
         }
 
         /*Clean up*/
@@ -226,6 +266,8 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         lv_memset_00(disp_refr->inv_area_joined, sizeof(disp_refr->inv_area_joined));
         disp_refr->inv_p = 0;
 
+        if(disp_refr->inv_by_anim) anim_refr_cnt++;
+
         elaps = lv_tick_elaps(start);
         /*Call monitor cb if present*/
         if(disp_refr->driver->monitor_cb) {
@@ -233,8 +275,9 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         }
     }
 
+    disp_refr->inv_by_anim = 0;
+
     lv_mem_buf_free_all();
-    _lv_font_clean_up_fmt_txt();
 
 #if LV_USE_PERF_MONITOR && LV_USE_LABEL
     static lv_obj_t * perf_label = NULL;
@@ -303,7 +346,14 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
         uint32_t used_size = mon.total_size - mon.free_size;;
         uint32_t used_kb = used_size / 1024;
         uint32_t used_kb_tenth = (used_size - (used_kb * 1024)) / 102;
+#if LV_MEM_SLAB_SIZE
+        uint32_t slab_kb = mon.slab_used / 1024;
+        uint32_t slab_kb_tenth = (mon.slab_used - (slab_kb * 1024)) / 102;
+        lv_label_set_text_fmt(mem_label, "%d.%d kB used (%d %%)\n%d%% frag.\n%d.%d kB in slabs (%d %% frag.)",
+                              used_kb,  used_kb_tenth, mon.used_pct, mon.frag_pct, slab_kb, slab_kb_tenth, mon.slab_frag_pct);
+#else
         lv_label_set_text_fmt(mem_label, "%d.%d kB used (%d %%)\n%d%% frag.", used_kb,  used_kb_tenth, mon.used_pct, mon.frag_pct);
+#endif
     }
 #endif
 
@@ -317,6 +367,11 @@ uint32_t lv_refr_get_fps_avg(void)
 }
 #endif
 
+uint32_t lv_refr_get_anim_refr_cnt(void)
+{
+    return anim_refr_cnt;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -358,6 +413,77 @@ static void lv_refr_join_area(void)
     }
 }
 
+/**
+ * Copy the areas redrawn in the previous frame from the displayed buffer to the draw buffer.
+ * Areas which will be fully redrawn in this frame are skipped.
+ */
+static void lv_refr_sync_areas(void)
+{
+    if(disp_refr->sync_p == 0) return;
+
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
+
+    /*The draw buffer can be written only when the display has released it*/
+    while(draw_buf->flushing) {
+        if(disp_refr->driver->wait_cb) disp_refr->driver->wait_cb(disp_refr->driver);
+    }
+
+    lv_color_t * buf_act = draw_buf->buf_act;
+    lv_color_t * buf_off = draw_buf->buf_act == draw_buf->buf1 ? draw_buf->buf2 : draw_buf->buf1;
+    lv_coord_t hor_res = lv_disp_get_hor_res(disp_refr);
+
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < disp_refr->sync_p; i++) {
+        const lv_area_t * sync_area = &disp_refr->sync_areas[i];
+
+        bool redrawn = false;
+        for(j = 0; j < disp_refr->inv_p; j++) {
+            if(disp_refr->inv_area_joined[j]) continue;
+            if(_lv_area_is_in(sync_area, &disp_refr->inv_areas[j], 0)) {
+                redrawn = true;
+                break;
+            }
+        }
+        if(redrawn) continue;
+
+        lv_coord_t w = lv_area_get_width(sync_area);
+        lv_coord_t h = lv_area_get_height(sync_area);
+        uint32_t offset = (uint32_t)sync_area->y1 * hor_res + sync_area->x1;
+
+#if LV_USE_GPU_NXP_PXP
+        if(lv_area_get_size(sync_area) >= LV_GPU_NXP_PXP_BUFF_SYNC_BLIT_SIZE_LIMIT) {
+            lv_gpu_nxp_pxp_blit(buf_act + offset, hor_res, buf_off + offset, hor_res, w, h, LV_OPA_COVER);
+            continue;
+        }
+        lv_gpu_nxp_pxp_wait_area(buf_act, hor_res, sync_area);
+#endif
+
+        lv_coord_t y;
+        for(y = 0; y < h; y++) {
+            lv_memcpy(buf_act + offset, buf_off + offset, w * sizeof(lv_color_t));
+            offset += hor_res;
+        }
+    }
+
+    disp_refr->sync_p = 0;
+}
+
+/**
+ * Remember the areas redrawn in this frame. The other buffer will be synchronized with them
+ * before the next frame is rendered.
+ */
+static void lv_refr_save_sync_areas(void)
+{
+    uint32_t i;
+    disp_refr->sync_p = 0;
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(disp_refr->inv_area_joined[i]) continue;
+        lv_area_copy(&disp_refr->sync_areas[disp_refr->sync_p], &disp_refr->inv_areas[i]);
+        disp_refr->sync_p++;
+    }
+}
+
 /**
  * Refresh the joined areas
  */
@@ -400,13 +526,15 @@ static void lv_refr_areas(void)
 static void lv_refr_area(const lv_area_t * area_p)
 {
     /*With full refresh just redraw directly into the buffer*/
-    if(disp_refr->driver->full_refresh) {
+    /*In direct mode draw directly on the absolute coordinates of the buffer*/
+    if(disp_refr->driver->full_refresh || disp_refr->driver->direct_mode) {
         lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
         draw_buf->area.x1        = 0;
         draw_buf->area.x2        = lv_disp_get_hor_res(disp_refr) - 1;
         draw_buf->area.y1        = 0;
         draw_buf->area.y2        = lv_disp_get_ver_res(disp_refr) - 1;
-        disp_refr->driver->draw_buf->last_part = 1;
+        if(disp_refr->driver->full_refresh) disp_refr->driver->draw_buf->last_part = 1;
+        else disp_refr->driver->draw_buf->last_part = disp_refr->driver->draw_buf->last_area;
         lv_refr_area_part(area_p);
         return;
     }
@@ -555,9 +683,10 @@ static void lv_refr_area_part(const lv_area_t * area_p)
     lv_refr_obj_and_children(lv_disp_get_layer_sys(disp_refr), &start_mask);
 
     /*In true double buffered mode flush only once when all areas were rendered.
-     *In normal mode flush after every area*/
+     *In normal mode flush after every area.
+     *In direct mode flush only the redrawn area of the screen sized buffer*/
     if(disp_refr->driver->full_refresh == false) {
-        draw_buf_flush();
+        draw_buf_flush(disp_refr->driver->direct_mode ? &start_mask : &draw_buf->area);
     }
 }
 
@@ -813,8 +942,8 @@ static void draw_buf_rotate_90_sqr(bool is_270, lv_coord_t w, lv_color_t * color
  */
 static void draw_buf_rotate(lv_area_t *area, lv_color_t *color_p) {
     lv_disp_drv_t * drv = disp_refr->driver;
-    if(disp_refr->driver->full_refresh && drv->sw_rotate) {
-        LV_LOG_ERROR("cannot rotate a full refreshed display!");
+    if((disp_refr->driver->full_refresh || disp_refr->driver->direct_mode) && drv->sw_rotate) {
+        LV_LOG_ERROR("cannot rotate a full refreshed or direct mode display!");
         return;
     }
     if(drv->rotated == LV_DISP_ROT_180) {
@@ -887,8 +1016,9 @@ static void draw_buf_rotate(lv_area_t *area, lv_color_t *color_p) {
 
 /**
  * Flush the content of the draw buffer
+ * @param flush_area the area to pass to the driver's `flush_cb`
  */
-static void draw_buf_flush(void)
+static void draw_buf_flush(const lv_area_t * flush_area)
 {
     lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp_refr);
     lv_color_t * color_p = draw_buf->buf_act;
@@ -898,19 +1028,26 @@ static void draw_buf_flush(void)
     if(disp_refr->driver->draw_buf->last_area && disp_refr->driver->draw_buf->last_part) draw_buf->flushing_last = 1;
     else draw_buf->flushing_last = 0;
 
+    /*Save it because the driver clears it when the flushing is ready*/
+    bool flushing_last = draw_buf->flushing_last;
+
     /*Flush the rendered content to the display*/
     lv_disp_t * disp = _lv_refr_get_disp_refreshing();
     if(disp->driver->gpu_wait_cb) disp->driver->gpu_wait_cb(disp->driver);
+#if LV_USE_GPU_NXP_PXP
+    lv_gpu_nxp_pxp_wait();
+#endif
 
     if(disp->driver->flush_cb) {
         /*Rotate the buffer to the display's native orientation if necessary*/
         if(disp->driver->rotated != LV_DISP_ROT_NONE && disp->driver->sw_rotate) {
             draw_buf_rotate(&draw_buf->area, draw_buf->buf_act);
         } else {
-            call_flush_cb(disp->driver, &draw_buf->area, color_p);
+            call_flush_cb(disp->driver, flush_area, color_p);
         }
     }
-    if(draw_buf->buf1 && draw_buf->buf2) {
+    /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
+    if(draw_buf->buf1 && draw_buf->buf2 && (!disp->driver->direct_mode || flushing_last)) {
         if(draw_buf->buf_act == draw_buf->buf1)
             draw_buf->buf_act = draw_buf->buf2;
         else
@@ -64,6 +64,14 @@ void lv_refr_now(lv_disp_t * disp);
  */
 void _lv_inv_area(lv_disp_t * disp, const lv_area_t * area_p);
 
+/**
+ * Schedule the refresh of a display because something changed on it.
+ * The changes made while an animation step is applied are drawn by the same refresh
+ * which is counted as an animation driven refresh.
+ * @param disp pointer to the display
+ */
+void _lv_refr_schedule(lv_disp_t * disp);
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -86,6 +94,12 @@ void _lv_refr_set_disp_refreshing(lv_disp_t * disp);
 uint32_t lv_refr_get_fps_avg(void);
 #endif
 
+/**
+ * Get how many times the displays were refreshed because an animation invalidated an area
+ * @return the number of animation driven refreshes since start up
+ */
+uint32_t lv_refr_get_anim_refr_cnt(void);
+
 /**
  * Called periodically to handle the refreshing
  * @param timer pointer to the timer itself
@@ -25,6 +25,16 @@
  *********************/
 #define GPU_SIZE_LIMIT      240
 
+/*Mix two RGB565 pixels at once with the DSP instructions of Cortex-M4/M7.
+ *Elsewhere the pixels are mixed one by one with `lv_color_mix`*/
+#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0 && LV_COLOR_SCREEN_TRANSP == 0 && \
+    defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+    #define BLEND_RGB565_DSP    1
+    #include <arm_acle.h>
+#else
+    #define BLEND_RGB565_DSP    0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -66,6 +76,14 @@ static inline lv_color_t color_blend_true_color_additive(lv_color_t fg, lv_color
 static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_color_t bg, lv_opa_t opa);
 #endif
 
+#if BLEND_RGB565_DSP
+LV_ATTRIBUTE_FAST_MEM static inline uint32_t mix_rgb565x2(uint32_t fg, uint32_t bg, uint32_t mix);
+LV_ATTRIBUTE_FAST_MEM static inline uint32_t mix_rgb565x2_mask(uint32_t fg, uint32_t bg, uint32_t mix0, uint32_t mix1);
+LV_ATTRIBUTE_FAST_MEM static void map_opa_rgb565(lv_color_t * dest, const lv_color_t * src, int32_t len, lv_opa_t opa);
+LV_ATTRIBUTE_FAST_MEM static void map_mask_rgb565(lv_color_t * dest, const lv_color_t * src, const lv_opa_t * mask,
+                                                  int32_t len, lv_opa_t opa);
+#endif
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -159,6 +177,15 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
 
+#if LV_USE_GPU_NXP_PXP
+    /*Only the CPU paths have to wait for queued PXP jobs on the same pixels, the PXP runs its jobs in order*/
+    if(disp->driver->set_px_cb || mode != LV_BLEND_MODE_NORMAL || mask_res != LV_DRAW_MASK_RES_FULL_COVER ||
+       lv_area_get_size(&draw_area) < lv_gpu_nxp_pxp_get_size_limit(opa > LV_OPA_MAX ? LV_GPU_NXP_PXP_OP_FILL :
+                                                                     LV_GPU_NXP_PXP_OP_FILL_OPA)) {
+        lv_gpu_nxp_pxp_wait_area(disp_buf, lv_area_get_width(disp_area), &draw_area);
+    }
+#endif
+
     if(disp->driver->set_px_cb) {
         fill_set_px(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res);
     }
@@ -222,6 +249,15 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
         int32_t i;
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
+
+#if LV_USE_GPU_NXP_PXP
+    if(disp->driver->set_px_cb || mode != LV_BLEND_MODE_NORMAL || mask_res != LV_DRAW_MASK_RES_FULL_COVER ||
+       lv_area_get_size(&draw_area) < lv_gpu_nxp_pxp_get_size_limit(opa > LV_OPA_MAX ? LV_GPU_NXP_PXP_OP_BLIT :
+                                                                     LV_GPU_NXP_PXP_OP_BLIT_OPA)) {
+        lv_gpu_nxp_pxp_wait_area(disp_buf, lv_area_get_width(disp_area), &draw_area);
+    }
+#endif
+
     if(disp->driver->set_px_cb) {
         map_set_px(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res);
     }
@@ -317,7 +353,7 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
     if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
         if(opa > LV_OPA_MAX) {
 #if LV_USE_GPU_NXP_PXP
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_PXP_FILL_SIZE_LIMIT) {
+            if(lv_area_get_size(draw_area) >= lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_FILL)) {
                 lv_gpu_nxp_pxp_fill(disp_buf, disp_w, draw_area, color, opa);
                 return;
             }
@@ -349,7 +385,7 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
         /*No mask with opacity*/
         else {
 #if LV_USE_GPU_NXP_PXP
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_PXP_FILL_OPA_SIZE_LIMIT) {
+            if(lv_area_get_size(draw_area) >= lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_FILL_OPA)) {
                 lv_gpu_nxp_pxp_fill(disp_buf, disp_w, draw_area, color, opa);
                 return;
             }
@@ -433,7 +469,17 @@ LV_ATTRIBUTE_FAST_MEM static void fill_normal(const lv_area_t * disp_area, lv_co
                         }
                         else {
                             mask_tmp_x = (const lv_opa_t *)mask32;
-#if LV_COLOR_SCREEN_TRANSP
+#if BLEND_RGB565_DSP
+                            uint32_t c2 = color.full | ((uint32_t)color.full << 16);
+                            uint32_t res = mix_rgb565x2_mask(c2, disp_buf_first[x].full | ((uint32_t)disp_buf_first[x + 1].full << 16),
+                                                             mask_tmp_x[0], mask_tmp_x[1]);
+                            disp_buf_first[x].full = res;
+                            disp_buf_first[x + 1].full = res >> 16;
+                            res = mix_rgb565x2_mask(c2, disp_buf_first[x + 2].full | ((uint32_t)disp_buf_first[x + 3].full << 16),
+                                                    mask_tmp_x[2], mask_tmp_x[3]);
+                            disp_buf_first[x + 2].full = res;
+                            disp_buf_first[x + 3].full = res >> 16;
+#elif LV_COLOR_SCREEN_TRANSP
                             FILL_NORMAL_MASK_PX_SCR_TRANSP(x, color)
                             FILL_NORMAL_MASK_PX_SCR_TRANSP(x + 1, color)
                             FILL_NORMAL_MASK_PX_SCR_TRANSP(x + 2, color)
@@ -679,14 +725,16 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
     lv_disp_t * disp = _lv_refr_get_disp_refreshing();
 #endif
 
+#if BLEND_RGB565_DSP == 0
     int32_t x;
+#endif
     int32_t y;
 
     /*Simple fill (maybe with opacity), no masking*/
     if(mask_res == LV_DRAW_MASK_RES_FULL_COVER) {
         if(opa > LV_OPA_MAX) {
 #if LV_USE_GPU_NXP_PXP
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_PXP_BLIT_SIZE_LIMIT) {
+            if(lv_area_get_size(draw_area) >= lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_BLIT)) {
                 lv_gpu_nxp_pxp_blit(disp_buf_first, disp_w, map_buf_first, map_w, draw_area_w, draw_area_h, opa);
                 return;
             }
@@ -736,7 +784,7 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
         }
         else {
 #if LV_USE_GPU_NXP_PXP
-            if(lv_area_get_size(draw_area) >= LV_GPU_NXP_PXP_BLIT_OPA_SIZE_LIMIT) {
+            if(lv_area_get_size(draw_area) >= lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_BLIT_OPA)) {
                 lv_gpu_nxp_pxp_blit(disp_buf_first, disp_w, map_buf_first, map_w, draw_area_w, draw_area_h, opa);
                 return;
             }
@@ -778,7 +826,13 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
 #endif
 
             /*Software rendering*/
-
+#if BLEND_RGB565_DSP
+            for(y = 0; y < draw_area_h; y++) {
+                map_opa_rgb565(disp_buf_first, map_buf_first, draw_area_w, opa);
+                disp_buf_first += disp_w;
+                map_buf_first += map_w;
+            }
+#else
             for(y = 0; y < draw_area_h; y++) {
                 for(x = 0; x < draw_area_w; x++) {
 #if LV_COLOR_SCREEN_TRANSP
@@ -795,10 +849,19 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
                 disp_buf_first += disp_w;
                 map_buf_first += map_w;
             }
+#endif
         }
     }
     /*Masked*/
     else {
+#if BLEND_RGB565_DSP
+        for(y = 0; y < draw_area_h; y++) {
+            map_mask_rgb565(disp_buf_first, map_buf_first, mask, draw_area_w, opa);
+            disp_buf_first += disp_w;
+            mask += draw_area_w;
+            map_buf_first += map_w;
+        }
+#else
         /*Only the mask matters*/
         if(opa > LV_OPA_MAX) {
             /*Go to the first pixel of the row*/
@@ -884,6 +947,7 @@ LV_ATTRIBUTE_FAST_MEM static void map_normal(const lv_area_t * disp_area, lv_col
                 map_buf_first += map_w;
             }
         }
+#endif
     }
 }
 #if LV_DRAW_COMPLEX
@@ -1040,3 +1104,112 @@ static inline lv_color_t color_blend_true_color_subtractive(lv_color_t fg, lv_co
     return lv_color_mix(fg, bg, opa);
 }
 #endif
+
+#if BLEND_RGB565_DSP
+/*Divide the two 16 bit lanes by 255 like `LV_UDIV255`. Exact up to 0xFFFE in each lane.*/
+#define UDIV255_X2(x) ((((x) + 0x00010001 + (((x) >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF)
+
+/**
+ * Mix two pairs of RGB565 pixels with the same ratio. Gives the same result as `lv_color_mix`.
+ * The products of a channel fit into 16 bits, so a single 32 bit multiplication handles both pixels.
+ * @param fg two foreground pixels (the first in the lower 16 bits)
+ * @param bg two background pixels
+ * @param mix the ratio of `fg` (0..255)
+ * @return the two mixed pixels
+ */
+LV_ATTRIBUTE_FAST_MEM static inline uint32_t mix_rgb565x2(uint32_t fg, uint32_t bg, uint32_t mix)
+{
+    uint32_t mix_inv = 255 - mix;
+    uint32_t r = ((fg >> 11) & 0x001F001F) * mix + ((bg >> 11) & 0x001F001F) * mix_inv + 0x00800080;
+    uint32_t g = ((fg >> 5) & 0x003F003F) * mix + ((bg >> 5) & 0x003F003F) * mix_inv + 0x00800080;
+    uint32_t b = (fg & 0x001F001F) * mix + (bg & 0x001F001F) * mix_inv + 0x00800080;
+
+    return (UDIV255_X2(r) << 11) | (UDIV255_X2(g) << 5) | UDIV255_X2(b);
+}
+
+/**
+ * Mix two pairs of RGB565 pixels with different ratios. Gives the same result as `lv_color_mix`.
+ * A pixel's foreground and background channels are packed into one word
+ * and mixed with a single SMLAD: `fg * mix + bg * (255 - mix) + 128`.
+ * @param fg two foreground pixels (the first in the lower 16 bits)
+ * @param bg two background pixels
+ * @param mix0 the ratio of the first pixel (0..255)
+ * @param mix1 the ratio of the second pixel (0..255)
+ * @return the two mixed pixels
+ */
+LV_ATTRIBUTE_FAST_MEM static inline uint32_t mix_rgb565x2_mask(uint32_t fg, uint32_t bg, uint32_t mix0, uint32_t mix1)
+{
+    uint32_t w0 = mix0 | ((255 - mix0) << 16);
+    uint32_t w1 = mix1 | ((255 - mix1) << 16);
+    uint32_t px0 = (fg & 0xFFFF) | (bg << 16);
+    uint32_t px1 = (fg >> 16) | (bg & 0xFFFF0000);
+
+    uint32_t r = __smlad((px0 >> 11) & 0x001F001F, w0, 128) | (__smlad((px1 >> 11) & 0x001F001F, w1, 128) << 16);
+    uint32_t g = __smlad((px0 >> 5) & 0x003F003F, w0, 128) | (__smlad((px1 >> 5) & 0x003F003F, w1, 128) << 16);
+    uint32_t b = __smlad(px0 & 0x001F001F, w0, 128) | (__smlad(px1 & 0x001F001F, w1, 128) << 16);
+
+    return (UDIV255_X2(r) << 11) | (UDIV255_X2(g) << 5) | UDIV255_X2(b);
+}
+
+/**
+ * Mix a line of an image onto the destination with an opacity, two pixels at a time.
+ * @param dest the destination pixels
+ * @param src the pixels of the image
+ * @param len number of pixels
+ * @param opa opacity of the image
+ */
+LV_ATTRIBUTE_FAST_MEM static void map_opa_rgb565(lv_color_t * dest, const lv_color_t * src, int32_t len, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < len - 1; x += 2) {
+        uint32_t res = mix_rgb565x2(src[x].full | ((uint32_t)src[x + 1].full << 16),
+                                    dest[x].full | ((uint32_t)dest[x + 1].full << 16), opa);
+        dest[x].full = res;
+        dest[x + 1].full = res >> 16;
+    }
+
+    if(x < len) dest[x] = lv_color_mix(src[x], dest[x], opa);
+}
+
+/**
+ * Mix a line of an image onto the destination with a mask and an opacity, two pixels at a time.
+ * The ratios are the same as in the masked part of `map_normal`.
+ * @param dest the destination pixels
+ * @param src the pixels of the image
+ * @param mask the mask of the line
+ * @param len number of pixels
+ * @param opa opacity of the image
+ */
+LV_ATTRIBUTE_FAST_MEM static void map_mask_rgb565(lv_color_t * dest, const lv_color_t * src, const lv_opa_t * mask,
+                                                  int32_t len, lv_opa_t opa)
+{
+    int32_t x;
+    for(x = 0; x < len - 1; x += 2) {
+        uint32_t m0 = mask[x];
+        uint32_t m1 = mask[x + 1];
+        if((m0 | m1) == 0) continue;
+
+        if(opa <= LV_OPA_MAX) {
+            m0 = m0 >= LV_OPA_MAX ? opa : ((opa * m0) >> 8);
+            m1 = m1 >= LV_OPA_MAX ? opa : ((opa * m1) >> 8);
+        }
+
+        if((m0 & m1) == LV_OPA_COVER) {
+            dest[x] = src[x];
+            dest[x + 1] = src[x + 1];
+        }
+        else {
+            uint32_t res = mix_rgb565x2_mask(src[x].full | ((uint32_t)src[x + 1].full << 16),
+                                             dest[x].full | ((uint32_t)dest[x + 1].full << 16), m0, m1);
+            dest[x].full = res;
+            dest[x + 1].full = res >> 16;
+        }
+    }
+
+    if(x < len && mask[x]) {
+        lv_opa_t m = mask[x];
+        if(opa <= LV_OPA_MAX) m = m >= LV_OPA_MAX ? opa : ((opa * m) >> 8);
+        dest[x] = lv_color_mix(src[x], dest[x], m);
+    }
+}
+#endif
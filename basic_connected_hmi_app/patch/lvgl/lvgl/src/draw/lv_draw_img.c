@@ -237,10 +237,19 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
 {
     if(draw_dsc->opa <= LV_OPA_MIN) return LV_RES_OK;
 
-    _lv_img_cache_entry_t * cdsc = _lv_img_cache_open(src, draw_dsc->recolor, draw_dsc->frame_id);
+    _lv_img_cache_entry_t * cdsc = _lv_img_cache_open_recolor(src, draw_dsc->recolor, draw_dsc->recolor_opa,
+                                                              draw_dsc->frame_id);
 
     if(cdsc == NULL) return LV_RES_INV;
 
+    /*The cache already recolored the pixels, draw them as they are*/
+    lv_draw_img_dsc_t baked_dsc;
+    if(cdsc->recolor_baked) {
+        baked_dsc = *draw_dsc;
+        baked_dsc.recolor_opa = LV_OPA_TRANSP;
+        draw_dsc = &baked_dsc;
+    }
+
     bool chroma_keyed = lv_img_cf_is_chroma_keyed(cdsc->dec_dsc.header.cf);
     bool alpha_byte   = lv_img_cf_has_alpha(cdsc->dec_dsc.header.cf);
 
@@ -252,8 +261,28 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
     /*The decoder could open the image and gave the entire uncompressed image.
      *Just draw it!*/
     else if(cdsc->dec_dsc.img_data) {
+        const uint8_t * map_p = cdsc->dec_dsc.img_data;
+        lv_area_t map_area;
+        lv_area_copy(&map_area, coords);
+
+        /*Integer or half-integer zoom without rotation and anti-aliasing: draw a scaled copy kept in the cache*/
+        lv_draw_img_dsc_t scaled_dsc;
+        if(draw_dsc->angle == 0 && draw_dsc->zoom != LV_IMG_ZOOM_NONE && (draw_dsc->zoom & 0x7F) == 0 &&
+           draw_dsc->antialias == 0) {
+            lv_area_t scaled_area;
+            const uint8_t * scaled = _lv_img_cache_get_scaled(cdsc, draw_dsc->zoom, &draw_dsc->pivot, &scaled_area);
+            if(scaled) {
+                map_p = scaled;
+                lv_area_move(&scaled_area, coords->x1, coords->y1);
+                lv_area_copy(&map_area, &scaled_area);
+                scaled_dsc = *draw_dsc;
+                scaled_dsc.zoom = LV_IMG_ZOOM_NONE;
+                draw_dsc = &scaled_dsc;
+            }
+        }
+
         lv_area_t map_area_rot;
-        lv_area_copy(&map_area_rot, coords);
+        lv_area_copy(&map_area_rot, &map_area);
         if(draw_dsc->angle || draw_dsc->zoom != LV_IMG_ZOOM_NONE) {
             int32_t w = lv_area_get_width(coords);
             int32_t h = lv_area_get_height(coords);
@@ -275,7 +304,7 @@ LV_ATTRIBUTE_FAST_MEM static lv_res_t lv_img_draw_core(const lv_area_t * coords,
             return LV_RES_OK;
         }
 
-        lv_draw_map(coords, &mask_com, cdsc->dec_dsc.img_data, draw_dsc, chroma_keyed, alpha_byte);
+        lv_draw_map(&map_area, &mask_com, map_p, draw_dsc, chroma_keyed, alpha_byte);
     }
     /*The whole uncompressed image is not available. Try to read it line-by-line*/
     else {
@@ -370,7 +399,7 @@ LV_ATTRIBUTE_FAST_MEM static void lv_draw_map(const lv_area_t * map_area, const
     /* Simple case without masking and transformations */
     else if(other_mask_cnt == 0 && draw_dsc->angle == 0 && draw_dsc->zoom == LV_IMG_ZOOM_NONE &&
             (chroma_key == false || draw_dsc->recolor_opa == LV_OPA_TRANSP) /* combination of chroma key and recolor not supported */
-            && (lv_area_get_size(&draw_area) >= LV_GPU_NXP_PXP_BLIT_SIZE_LIMIT)
+            && (lv_area_get_size(&draw_area) >= lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_BLIT))
 #if LV_COLOR_DEPTH!=32
             && alpha_byte == false
 #endif
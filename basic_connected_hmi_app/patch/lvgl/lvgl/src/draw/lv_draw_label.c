@@ -19,6 +19,12 @@
 #define LABEL_RECOLOR_PAR_LENGTH 6
 #define LV_LABEL_HINT_UPDATE_TH 1024 /*Update the "hint" if the label's y coordinates have changed more then this*/
 
+/*Marks the end of a hash chain or list in the glyph cache*/
+#define GLYPH_CACHE_NONE 0xFFFF
+
+/*Number of hash chains of the glyph cache. Must be a power of 2.*/
+#define GLYPH_CACHE_BUCKET_CNT 128
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -29,6 +35,19 @@ enum {
 };
 typedef uint8_t cmd_state_t;
 
+#if LV_GLYPH_CACHE_SIZE
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+    lv_opa_t * buf;         /*`box_w * box_h` coverage values*/
+    uint16_t box_w;
+    uint16_t box_h;
+    uint16_t hash_next;     /*Next entry in the hash chain or in the free list*/
+    uint16_t lru_prev;
+    uint16_t lru_next;
+} glyph_cache_entry_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -40,10 +59,27 @@ static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_
                               const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
 #endif
 static uint8_t hex_char_to_num(char hex);
+#if LV_GLYPH_CACHE_SIZE
+LV_ATTRIBUTE_FAST_MEM static void draw_letter_a8(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g,
+                                                 const lv_area_t * clip_area,
+                                                 const lv_opa_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+static const lv_opa_t * glyph_cache_get(const lv_font_t * font_p, uint32_t letter, lv_font_glyph_dsc_t * g);
+static void glyph_cache_drop(uint16_t i);
+static void glyph_decode_a8(lv_font_glyph_dsc_t * g, const uint8_t * map_p, lv_opa_t * buf);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_GLYPH_CACHE_SIZE
+    static glyph_cache_entry_t glyph_cache[LV_GLYPH_CACHE_SIZE];
+    static uint16_t glyph_cache_buckets[GLYPH_CACHE_BUCKET_CNT];
+    static uint16_t glyph_cache_free;
+    static uint16_t glyph_lru_head;
+    static uint16_t glyph_lru_tail;
+    static bool glyph_cache_inited;
+    static lv_draw_glyph_cache_stats_t glyph_cache_stats;
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -382,6 +418,39 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+/**
+ * Get the statistics of the glyph cache
+ * @param stats store the statistics here
+ */
+void lv_draw_glyph_cache_get_stats(lv_draw_glyph_cache_stats_t * stats)
+{
+#if LV_GLYPH_CACHE_SIZE
+    *stats = glyph_cache_stats;
+    stats->budget = LV_GLYPH_CACHE_BUDGET;
+#else
+    lv_memset_00(stats, sizeof(lv_draw_glyph_cache_stats_t));
+#endif
+}
+
+/**
+ * Drop the cached glyphs of a font. Must be called before the font is freed,
+ * else a font created at the same address would be drawn with the glyphs of the freed one.
+ * @param font pointer to the font
+ */
+void _lv_glyph_cache_invalidate_font(const lv_font_t * font)
+{
+#if LV_GLYPH_CACHE_SIZE
+    if(glyph_cache_inited == false) return;
+
+    uint16_t i;
+    for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++) {
+        if(glyph_cache[i].buf && glyph_cache[i].font == font) glyph_cache_drop(i);
+    }
+#else
+    LV_UNUSED(font);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -435,6 +504,16 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_are
         return;
     }
 
+#if LV_GLYPH_CACHE_SIZE
+    if(font_p->subpx == LV_FONT_SUBPX_NONE) {
+        const lv_opa_t * a8 = glyph_cache_get(font_p, letter, &g);
+        if(a8) {
+            draw_letter_a8(pos_x, pos_y, &g, clip_area, a8, color, opa, blend_mode);
+            return;
+        }
+    }
+#endif
+
     const uint8_t * map_p = lv_font_get_glyph_bitmap(font_p, letter);
     if(map_p == NULL) {
         LV_LOG_WARN("lv_draw_letter: character's bitmap not found");
@@ -611,6 +690,271 @@ LV_ATTRIBUTE_FAST_MEM static void draw_letter_normal(lv_coord_t pos_x, lv_coord_
     lv_mem_buf_release(mask_buf);
 }
 
+#if LV_GLYPH_CACHE_SIZE
+/**
+ * Draw a letter from its 8 bit coverage map. Gives the same result as `draw_letter_normal`.
+ * If the letter is not clipped horizontally and there is nothing else to apply,
+ * the map is blended as it is without copying it to a mask buffer.
+ * @param pos_x x coordinate of the left of the letter's box
+ * @param pos_y y coordinate of the top of the letter's box
+ * @param g the glyph descriptor of the letter
+ * @param clip_area draw only in this area
+ * @param map_p `box_w * box_h` coverage values from `glyph_cache_get`
+ * @param color color of letter
+ * @param opa opacity of letter (0..255)
+ * @param blend_mode blend mode
+ */
+LV_ATTRIBUTE_FAST_MEM static void draw_letter_a8(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g,
+                                                 const lv_area_t * clip_area,
+                                                 const lv_opa_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
+{
+    int32_t col, row;
+    int32_t box_w = g->box_w;
+    int32_t box_h = g->box_h;
+
+    /*Calculate the col/row start/end on the map*/
+    int32_t col_start = pos_x >= clip_area->x1 ? 0 : clip_area->x1 - pos_x;
+    int32_t col_end   = pos_x + box_w <= clip_area->x2 ? box_w : clip_area->x2 - pos_x + 1;
+    int32_t row_start = pos_y >= clip_area->y1 ? 0 : clip_area->y1 - pos_y;
+    int32_t row_end   = pos_y + box_h <= clip_area->y2 ? box_h : clip_area->y2 - pos_y + 1;
+
+    map_p += row_start * box_w + col_start;
+
+    lv_area_t fill_area;
+    fill_area.x1 = col_start + pos_x;
+    fill_area.x2 = col_end  + pos_x - 1;
+    fill_area.y1 = row_start + pos_y;
+    fill_area.y2 = row_end + pos_y - 1;
+#if LV_DRAW_COMPLEX
+    uint8_t other_mask_cnt = lv_draw_mask_get_cnt();
+#else
+    uint8_t other_mask_cnt = 0;
+#endif
+
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+
+    /*Blend the whole letter straight from the cache.
+     *Without anti-aliasing the mask is rounded in place, so it needs a copy.*/
+    if(opa >= LV_OPA_MAX && other_mask_cnt == 0 && col_start == 0 && col_end == box_w && disp->driver->antialiasing) {
+        _lv_blend_fill(clip_area, &fill_area,
+                       color, (lv_opa_t *)map_p, LV_DRAW_MASK_RES_CHANGED, LV_OPA_COVER,
+                       blend_mode);
+        return;
+    }
+
+    lv_coord_t hor_res = lv_disp_get_hor_res(disp);
+    uint32_t mask_buf_size = box_w * box_h > hor_res ? hor_res : box_w * box_h;
+    lv_opa_t * mask_buf = lv_mem_buf_get(mask_buf_size);
+    int32_t mask_p = 0;
+    int32_t w = col_end - col_start;
+
+    fill_area.y2 = fill_area.y1;
+    for(row = row_start ; row < row_end; row++) {
+        if(opa < LV_OPA_MAX) {
+            for(col = 0; col < w; col++) {
+                mask_buf[mask_p + col] = map_p[col] == LV_OPA_COVER ? opa : ((map_p[col] * opa) >> 8);
+            }
+        }
+        else {
+            lv_memcpy(mask_buf + mask_p, map_p, w);
+        }
+
+#if LV_DRAW_COMPLEX
+        /*Apply masks if any*/
+        if(other_mask_cnt) {
+            lv_draw_mask_res_t mask_res = lv_draw_mask_apply(mask_buf + mask_p, fill_area.x1, fill_area.y2, w);
+            if(mask_res == LV_DRAW_MASK_RES_TRANSP) {
+                lv_memset_00(mask_buf + mask_p, w);
+            }
+        }
+#endif
+        mask_p += w;
+
+        if((uint32_t) mask_p + w < mask_buf_size) {
+            fill_area.y2 ++;
+        }
+        else {
+            _lv_blend_fill(clip_area, &fill_area,
+                           color, mask_buf, LV_DRAW_MASK_RES_CHANGED, LV_OPA_COVER,
+                           blend_mode);
+
+            fill_area.y1 = fill_area.y2 + 1;
+            fill_area.y2 = fill_area.y1;
+            mask_p = 0;
+        }
+
+        map_p += box_w;
+    }
+
+    /*Flush the last part*/
+    if(fill_area.y1 != fill_area.y2) {
+        fill_area.y2--;
+        _lv_blend_fill(clip_area, &fill_area,
+                       color, mask_buf, LV_DRAW_MASK_RES_CHANGED, LV_OPA_COVER,
+                       blend_mode);
+    }
+
+    lv_mem_buf_release(mask_buf);
+}
+
+/**
+ * Get the 8 bit coverage map of a glyph from the cache.
+ * On a miss the font's bitmap is unpacked into the cache, dropping the least recently used glyphs if required.
+ * @param font_p pointer to font
+ * @param letter the letter
+ * @param g the glyph descriptor of the letter
+ * @return `box_w * box_h` coverage values or NULL if the glyph can't be cached
+ */
+static const lv_opa_t * glyph_cache_get(const lv_font_t * font_p, uint32_t letter, lv_font_glyph_dsc_t * g)
+{
+    uint16_t i;
+    if(glyph_cache_inited == false) {
+        for(i = 0; i < GLYPH_CACHE_BUCKET_CNT; i++) glyph_cache_buckets[i] = GLYPH_CACHE_NONE;
+        for(i = 0; i < LV_GLYPH_CACHE_SIZE; i++) glyph_cache[i].hash_next = i + 1 < LV_GLYPH_CACHE_SIZE ? i + 1 : GLYPH_CACHE_NONE;
+        glyph_cache_free = 0;
+        glyph_lru_head = GLYPH_CACHE_NONE;
+        glyph_lru_tail = GLYPH_CACHE_NONE;
+        glyph_cache_inited = true;
+    }
+
+    uint32_t hash = (((lv_uintptr_t)font_p >> 2) ^ letter) * 2654435761U;
+    uint16_t * bucket = &glyph_cache_buckets[(hash >> 16) & (GLYPH_CACHE_BUCKET_CNT - 1)];
+    for(i = *bucket; i != GLYPH_CACHE_NONE; i = glyph_cache[i].hash_next) {
+        glyph_cache_entry_t * e = &glyph_cache[i];
+        if(e->letter != letter || e->font != font_p) continue;
+
+        glyph_cache_stats.hits++;
+        if(glyph_lru_head != i) {
+            /*Move to the head of the LRU list*/
+            glyph_cache[e->lru_prev].lru_next = e->lru_next;
+            if(e->lru_next != GLYPH_CACHE_NONE) glyph_cache[e->lru_next].lru_prev = e->lru_prev;
+            else glyph_lru_tail = e->lru_prev;
+            e->lru_prev = GLYPH_CACHE_NONE;
+            e->lru_next = glyph_lru_head;
+            glyph_cache[glyph_lru_head].lru_prev = i;
+            glyph_lru_head = i;
+        }
+        return e->buf;
+    }
+
+    glyph_cache_stats.misses++;
+
+    uint32_t size = (uint32_t)g->box_w * g->box_h;
+    if(size > LV_GLYPH_CACHE_BUDGET) return NULL;
+
+    /*Make room for the new glyph*/
+    while(glyph_cache_free == GLYPH_CACHE_NONE || glyph_cache_stats.size + size > LV_GLYPH_CACHE_BUDGET) {
+        glyph_cache_drop(glyph_lru_tail);
+        glyph_cache_stats.evictions++;
+    }
+
+    lv_opa_t * buf = lv_mem_alloc(size);
+    if(buf == NULL) return NULL;
+
+    const uint8_t * map_p = lv_font_get_glyph_bitmap(font_p, letter);
+    if(map_p == NULL) {
+        lv_mem_free(buf);
+        return NULL;
+    }
+    glyph_decode_a8(g, map_p, buf);
+
+    i = glyph_cache_free;
+    glyph_cache_entry_t * e = &glyph_cache[i];
+    glyph_cache_free = e->hash_next;
+
+    e->font = font_p;
+    e->letter = letter;
+    e->buf = buf;
+    e->box_w = g->box_w;
+    e->box_h = g->box_h;
+    e->hash_next = *bucket;
+    *bucket = i;
+
+    e->lru_prev = GLYPH_CACHE_NONE;
+    e->lru_next = glyph_lru_head;
+    if(glyph_lru_head != GLYPH_CACHE_NONE) glyph_cache[glyph_lru_head].lru_prev = i;
+    else glyph_lru_tail = i;
+    glyph_lru_head = i;
+
+    glyph_cache_stats.size += size;
+    glyph_cache_stats.entries++;
+
+    return buf;
+}
+
+/**
+ * Remove a glyph from the cache and free its coverage map
+ * @param i index of a used entry
+ */
+static void glyph_cache_drop(uint16_t i)
+{
+    glyph_cache_entry_t * e = &glyph_cache[i];
+
+    /*Unlink from the hash chain*/
+    uint32_t hash = (((lv_uintptr_t)e->font >> 2) ^ e->letter) * 2654435761U;
+    uint16_t * next_p = &glyph_cache_buckets[(hash >> 16) & (GLYPH_CACHE_BUCKET_CNT - 1)];
+    while(*next_p != i) next_p = &glyph_cache[*next_p].hash_next;
+    *next_p = e->hash_next;
+
+    /*Unlink from the LRU list*/
+    if(e->lru_prev != GLYPH_CACHE_NONE) glyph_cache[e->lru_prev].lru_next = e->lru_next;
+    else glyph_lru_head = e->lru_next;
+    if(e->lru_next != GLYPH_CACHE_NONE) glyph_cache[e->lru_next].lru_prev = e->lru_prev;
+    else glyph_lru_tail = e->lru_prev;
+
+    glyph_cache_stats.size -= (uint32_t)e->box_w * e->box_h;
+    glyph_cache_stats.entries--;
+
+    lv_mem_free(e->buf);
+    e->buf = NULL;
+    e->font = NULL;
+    e->hash_next = glyph_cache_free;
+    glyph_cache_free = i;
+}
+
+/**
+ * Unpack the bitmap of a glyph to 8 bit coverage values. The values are the same as `draw_letter_normal` puts into its mask.
+ * @param g the glyph descriptor
+ * @param map_p the bitmap of the glyph
+ * @param buf store `box_w * box_h` values here
+ */
+static void glyph_decode_a8(lv_font_glyph_dsc_t * g, const uint8_t * map_p, lv_opa_t * buf)
+{
+    const uint8_t * bpp_opa_table_p;
+    uint32_t bpp = g->bpp;
+    if(bpp == 3) bpp = 4;
+
+    switch(bpp) {
+        case 1:
+            bpp_opa_table_p = _lv_bpp1_opa_table;
+            break;
+        case 2:
+            bpp_opa_table_p = _lv_bpp2_opa_table;
+            break;
+        case 4:
+            bpp_opa_table_p = _lv_bpp4_opa_table;
+            break;
+        case 8:
+            bpp_opa_table_p = _lv_bpp8_opa_table;
+            break;
+        default:
+            LV_LOG_WARN("glyph_decode_a8: invalid bpp");
+            lv_memset_00(buf, (uint32_t)g->box_w * g->box_h);
+            return;
+    }
+
+    /*The rows follow each other without padding*/
+    uint32_t px_cnt = (uint32_t)g->box_w * g->box_h;
+    uint32_t mask = (1 << bpp) - 1;
+    uint32_t bit = 0;
+    uint32_t i;
+    for(i = 0; i < px_cnt; i++) {
+        buf[i] = bpp_opa_table_p[(map_p[bit >> 3] >> (8 - bpp - (bit & 0x7))) & mask];
+        bit += bpp;
+    }
+}
+#endif
+
 #if LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX
 static void draw_letter_subpx(lv_coord_t pos_x, lv_coord_t pos_y, lv_font_glyph_dsc_t * g, const lv_area_t * clip_area,
                               const uint8_t * map_p, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode)
@@ -63,6 +63,18 @@ typedef struct _lv_draw_label_hint_t {
     int32_t coord_y;
 } lv_draw_label_hint_t;
 
+/**
+ * Statistics of the glyph cache
+ */
+typedef struct {
+    uint32_t hits;          /**< Number of glyphs drawn from the cache*/
+    uint32_t misses;        /**< Number of glyphs read from the font*/
+    uint32_t evictions;     /**< Number of glyphs dropped to make room for a new one*/
+    uint32_t size;          /**< Bytes of cached coverage maps*/
+    uint32_t budget;        /**< Upper limit of `size`*/
+    uint16_t entries;       /**< Number of cached glyphs*/
+} lv_draw_glyph_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -87,6 +99,18 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_label(const lv_area_t * coords, const lv_area
 LV_ATTRIBUTE_FAST_MEM void lv_draw_letter(const lv_point_t * pos_p, const lv_area_t * clip_area,
                                           const lv_font_t * font_p,
                                           uint32_t letter, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
+
+/**
+ * Get the statistics of the glyph cache
+ * @param stats store the statistics here
+ */
+void lv_draw_glyph_cache_get_stats(lv_draw_glyph_cache_stats_t * stats);
+
+/**
+ * Drop the cached glyphs of a font before it's freed
+ * @param font pointer to the font
+ */
+void _lv_glyph_cache_invalidate_font(const lv_font_t * font);
 //! @endcond
 /***********************
  * GLOBAL VARIABLES
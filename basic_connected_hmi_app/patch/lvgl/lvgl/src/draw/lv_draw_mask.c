@@ -18,10 +18,24 @@
 /*********************
  *      DEFINES
  *********************/
+/*Pixels outside of the rectangle and inside of the radius kept in a circle table*/
+#define CIRCLE_CACHE_MARGIN     4
+
+/*Larger radii are not cached to limit the memory usage*/
+#define CIRCLE_CACHE_MAX_RADIUS 64
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_CIRCLE_CACHE_SIZE
+typedef struct {
+    lv_opa_t * buf;
+    uint32_t last_used;
+    uint32_t size;
+    lv_coord_t radius;
+    uint8_t outer;
+} circle_cache_entry_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -49,12 +63,30 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t line_mask_steep(lv_opa_t * mask_
                                                                 lv_coord_t len,
                                                                 lv_draw_mask_line_param_t * p);
 
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t radius_corner(lv_opa_t * mask_buf, lv_coord_t len, int32_t k,
+                                                              int32_t w, int32_t h, int32_t abs_y,
+                                                              lv_draw_mask_radius_param_t * p);
+#if LV_CIRCLE_CACHE_SIZE
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t radius_corner_cached(lv_opa_t * mask_buf, lv_coord_t len, int32_t k,
+                                                                     int32_t w, int32_t h, int32_t abs_y,
+                                                                     int32_t radius, bool outer,
+                                                                     const lv_opa_t * circle);
+static const lv_opa_t * circle_cache_get(int32_t radius, bool outer);
+static bool circle_cache_drop_oldest(void);
+#endif
+
 LV_ATTRIBUTE_FAST_MEM static inline lv_opa_t mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
 LV_ATTRIBUTE_FAST_MEM static inline void sqrt_approx(lv_sqrt_res_t * q, lv_sqrt_res_t * ref, uint32_t x);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_CIRCLE_CACHE_SIZE
+    static circle_cache_entry_t circle_cache[LV_CIRCLE_CACHE_SIZE];
+    static uint32_t circle_cache_time;
+    static uint32_t circle_cache_size;
+    static uint32_t circle_cache_budget = LV_CIRCLE_CACHE_BUDGET;
+#endif
 
 /**********************
  *      MACROS
@@ -422,6 +454,16 @@ void lv_draw_mask_map_init(lv_draw_mask_map_param_t * param, const lv_area_t * c
     param->dsc.type = LV_DRAW_MASK_TYPE_MAP;
 }
 
+void lv_draw_mask_circle_cache_set_budget(uint32_t budget)
+{
+#if LV_CIRCLE_CACHE_SIZE
+    circle_cache_budget = budget;
+    while(circle_cache_size > budget && circle_cache_drop_oldest());
+#else
+    LV_UNUSED(budget);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -936,13 +978,40 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * m
     int32_t k = rect.x1 - abs_x; /*First relevant coordinate on the of the mask*/
     int32_t w = lv_area_get_width(&rect);
     int32_t h = lv_area_get_height(&rect);
-    abs_x -= rect.x1;
     abs_y -= rect.y1;
 
-    uint32_t r2 = p->cfg.radius * p->cfg.radius;
-
     /*Handle corner areas*/
     if(abs_y < radius || abs_y > h - radius - 1) {
+#if LV_CIRCLE_CACHE_SIZE
+        const lv_opa_t * circle = circle_cache_get(radius, outer);
+        if(circle) return radius_corner_cached(mask_buf, len, k, w, h, abs_y, radius, outer, circle);
+#endif
+        return radius_corner(mask_buf, len, k, w, h, abs_y, p);
+    }
+
+    return LV_DRAW_MASK_RES_CHANGED;
+}
+
+/**
+ * Apply a radius mask on a line crossing the rounded corners.
+ * @param mask_buf the mask line to modify
+ * @param len length of `mask_buf`
+ * @param k position of the rectangle's left edge in `mask_buf`
+ * @param w width of the rectangle
+ * @param h height of the rectangle
+ * @param abs_y y coordinate of the line relative to the rectangle's top. Should be in a corner.
+ * @param p the radius mask parameter
+ * @return the result of the mask
+ */
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t radius_corner(lv_opa_t * mask_buf, lv_coord_t len, int32_t k,
+                                                              int32_t w, int32_t h, int32_t abs_y,
+                                                              lv_draw_mask_radius_param_t * p)
+{
+    bool outer = p->cfg.outer;
+    int32_t radius = p->cfg.radius;
+    uint32_t r2 = p->cfg.radius * p->cfg.radius;
+
+    {
 
         uint32_t sqrt_mask;
         if(radius <= 32) sqrt_mask = 0x200;
@@ -1132,6 +1201,171 @@ LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_radius(lv_opa_t * m
     return LV_DRAW_MASK_RES_CHANGED;
 }
 
+#if LV_CIRCLE_CACHE_SIZE
+/**
+ * Apply a radius mask on a line crossing the rounded corners using a cached circle table.
+ * The result is the same as `radius_corner` would give.
+ * @param mask_buf the mask line to modify
+ * @param len length of `mask_buf`
+ * @param k position of the rectangle's left edge in `mask_buf`
+ * @param w width of the rectangle
+ * @param h height of the rectangle
+ * @param abs_y y coordinate of the line relative to the rectangle's top. Should be in a corner.
+ * @param radius radius of the corners
+ * @param outer true: the mask is inverted
+ * @param circle the table of the radius from `circle_cache_get`
+ * @return the result of the mask
+ */
+LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t radius_corner_cached(lv_opa_t * mask_buf, lv_coord_t len, int32_t k,
+                                                                     int32_t w, int32_t h, int32_t abs_y,
+                                                                     int32_t radius, bool outer,
+                                                                     const lv_opa_t * circle)
+{
+    /*The same circle row index `radius_corner` calculates*/
+    int32_t y = abs_y < radius ? radius - abs_y : radius - (h - abs_y) + 1;
+    int32_t row_w = radius + 2 * CIRCLE_CACHE_MARGIN;
+    const lv_opa_t * row = circle + (y - 1) * row_w;
+
+    if(outer == false) {
+        /*The whole line is left of the first or right of the last non-zero pixel*/
+        int32_t first = circle[radius * row_w + y - 1] - CIRCLE_CACHE_MARGIN;
+        if(k + first >= len || k + w - 1 - first < 0) return LV_DRAW_MASK_RES_TRANSP;
+    }
+
+    /*The left table covers the left half of the rectangle, the mirrored table the right half*/
+    int32_t half = w / 2;
+    int32_t left_end = LV_MIN(radius + CIRCLE_CACHE_MARGIN, half);
+    int32_t right_end = LV_MIN(radius + CIRCLE_CACHE_MARGIN, w - half);
+
+    int32_t x;
+    int32_t x_start = LV_MAX(-CIRCLE_CACHE_MARGIN, -k);
+    int32_t x_end = LV_MIN(left_end, len - k);
+    for(x = x_start; x < x_end; x++) {
+        mask_buf[k + x] = mask_mix(mask_buf[k + x], row[x + CIRCLE_CACHE_MARGIN]);
+    }
+
+    /*Mirrored: `x` is the distance from the right edge*/
+    int32_t kr = k + w - 1;
+    x_start = LV_MAX(-CIRCLE_CACHE_MARGIN, kr - len + 1);
+    x_end = LV_MIN(right_end, kr + 1);
+    for(x = x_start; x < x_end; x++) {
+        mask_buf[kr - x] = mask_mix(mask_buf[kr - x], row[x + CIRCLE_CACHE_MARGIN]);
+    }
+
+    /*Clear the parts the tables don't cover*/
+    if(outer == false) {
+        int32_t last = LV_MIN(k - CIRCLE_CACHE_MARGIN, len);
+        if(last > 0) lv_memset_00(&mask_buf[0], last);
+
+        int32_t first = LV_MAX(kr + CIRCLE_CACHE_MARGIN + 1, 0);
+        if(first < len) lv_memset_00(&mask_buf[first], len - first);
+    }
+    else {
+        int32_t first = LV_MAX(k + left_end, 0);
+        int32_t last = LV_MIN(kr - right_end + 1, len);
+        if(first < last) lv_memset_00(&mask_buf[first], last - first);
+    }
+
+    return LV_DRAW_MASK_RES_CHANGED;
+}
+
+/**
+ * Get the coverage table of a circle. It's built with `radius_corner` on the first use.
+ * Row `y - 1` holds the mask of the left corner for the circle row `y` (1..radius),
+ * from `CIRCLE_CACHE_MARGIN` pixels left of the rectangle to `radius + CIRCLE_CACHE_MARGIN` pixels into it.
+ * Pixels further inside are kept if not `outer` and cleared if `outer`; pixels further outside the opposite.
+ * The next `radius` bytes are the index of the first non-zero pixel of each row.
+ * The least recently used tables are freed to keep the cached bytes in the budget.
+ * @param radius the radius of the circle
+ * @param outer true: the table of an inverted mask
+ * @return the table or NULL if the radius is not cached
+ */
+static const lv_opa_t * circle_cache_get(int32_t radius, bool outer)
+{
+    if(radius > CIRCLE_CACHE_MAX_RADIUS) return NULL;
+
+    circle_cache_time++;
+
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        circle_cache_entry_t * e = &circle_cache[i];
+        if(e->buf && e->radius == radius && e->outer == outer) {
+            e->last_used = circle_cache_time;
+            return e->buf;
+        }
+    }
+
+    int32_t row_w = radius + 2 * CIRCLE_CACHE_MARGIN;
+    uint32_t size = radius * row_w + radius;
+    if(size > circle_cache_budget) return NULL;
+
+    /*Drop the least recently used tables until the new one fits and there is a free entry*/
+    circle_cache_entry_t * free_e = NULL;
+    while(1) {
+        for(i = 0; i < LV_CIRCLE_CACHE_SIZE && circle_cache[i].buf; i++);
+        free_e = i < LV_CIRCLE_CACHE_SIZE ? &circle_cache[i] : NULL;
+        if(free_e && circle_cache_size + size <= circle_cache_budget) break;
+        if(!circle_cache_drop_oldest()) return NULL;
+    }
+
+    lv_opa_t * buf = lv_mem_alloc(size);
+    if(buf == NULL) return NULL;
+
+    free_e->buf = buf;
+    free_e->size = size;
+    free_e->radius = radius;
+    free_e->outer = outer;
+    free_e->last_used = circle_cache_time;
+    circle_cache_size += size;
+
+    /*Use a rectangle wide enough to keep the right corner out of the table*/
+    lv_area_t rect;
+    rect.x1 = 0;
+    rect.y1 = 0;
+    rect.x2 = 2 * row_w - 1;
+    rect.y2 = 2 * row_w - 1;
+    lv_draw_mask_radius_param_t p;
+    lv_draw_mask_radius_init(&p, &rect, radius, outer);
+
+    /*Row `y` of the circle is the line `radius - y` from the top*/
+    int32_t y;
+    for(y = 1; y <= radius; y++) {
+        lv_opa_t * row = buf + (y - 1) * row_w;
+        lv_memset_ff(row, row_w);
+        if(radius_corner(row, row_w, CIRCLE_CACHE_MARGIN, rect.x2 + 1, rect.y2 + 1, radius - y, &p) ==
+           LV_DRAW_MASK_RES_TRANSP) {
+            lv_memset_00(row, row_w);
+        }
+
+        int32_t x;
+        for(x = 0; x < row_w - 1 && row[x] == 0; x++);
+        buf[radius * row_w + y - 1] = x;
+    }
+
+    return buf;
+}
+
+/**
+ * Free the least recently used circle table
+ * @return false if there was no table to free
+ */
+static bool circle_cache_drop_oldest(void)
+{
+    circle_cache_entry_t * oldest = NULL;
+    uint32_t i;
+    for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
+        circle_cache_entry_t * e = &circle_cache[i];
+        if(e->buf && (oldest == NULL || e->last_used < oldest->last_used)) oldest = e;
+    }
+    if(oldest == NULL) return false;
+
+    lv_mem_free(oldest->buf);
+    oldest->buf = NULL;
+    circle_cache_size -= oldest->size;
+    return true;
+}
+#endif
+
 LV_ATTRIBUTE_FAST_MEM static lv_draw_mask_res_t lv_draw_mask_fade(lv_opa_t * mask_buf, lv_coord_t abs_x,
                                                                   lv_coord_t abs_y, lv_coord_t len,
                                                                   lv_draw_mask_fade_param_t * p)
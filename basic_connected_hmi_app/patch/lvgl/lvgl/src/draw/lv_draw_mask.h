@@ -313,6 +313,13 @@ void lv_draw_mask_fade_init(lv_draw_mask_fade_param_t * param, const lv_area_t *
  */
 void lv_draw_mask_map_init(lv_draw_mask_map_param_t * param, const lv_area_t * coords, const lv_opa_t * map);
 
+/**
+ * Set how many bytes of circle coverage tables the radius masks can keep.
+ * The least recently used tables are freed when the budget is exceeded.
+ * @param budget size in bytes. 0: compute every corner without a table
+ */
+void lv_draw_mask_circle_cache_set_budget(uint32_t budget);
+
 #endif /*LV_DRAW_COMPLEX*/
 
 /**********************
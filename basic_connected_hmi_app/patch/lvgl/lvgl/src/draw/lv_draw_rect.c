@@ -21,9 +21,26 @@
 #define SHADOW_ENHANCE          1
 #define SPLIT_LIMIT             50
 
+/*Number of shadow corners to cache. The cached bytes are limited by `LV_SHADOW_CACHE_BUDGET`*/
+#define SHADOW_CACHE_ENTRY_CNT  16
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
+/*A blurred shadow corner. The edges are drawn from its last row and column.
+ *It depends only on the shadow width, the radius and the size of the shadow rectangle.
+ *Rectangles larger than `w`/`h` in a dimension share the same corner so these are clamped.*/
+typedef struct {
+    lv_opa_t * buf;
+    uint32_t last_used;
+    lv_coord_t size;
+    lv_coord_t sw;
+    lv_coord_t r;
+    lv_coord_t w;
+    lv_coord_t h;
+} sh_cache_entry_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -43,6 +60,11 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
 LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coords,  uint16_t * sh_buf, lv_coord_t s,
                                                          lv_coord_t r);
 LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(lv_coord_t size, lv_coord_t sw, uint16_t * sh_ups_buf);
+#if LV_SHADOW_CACHE_SIZE
+static sh_cache_entry_t * shadow_cache_find(lv_coord_t size, lv_coord_t sw, lv_coord_t r, lv_coord_t w, lv_coord_t h);
+static void shadow_cache_add(const lv_opa_t * sh_buf, lv_coord_t size, lv_coord_t sw, lv_coord_t r, lv_coord_t w,
+                             lv_coord_t h);
+#endif
 
 static void draw_full_border(const lv_area_t * area_inner, const lv_area_t * area_outer, const lv_area_t * clip,
                              lv_coord_t radius, bool radius_is_in, lv_color_t color, lv_opa_t opa, lv_blend_mode_t blend_mode);
@@ -59,9 +81,9 @@ LV_ATTRIBUTE_FAST_MEM static inline lv_color_t grad_get(const lv_draw_rect_dsc_t
  *  STATIC VARIABLES
  **********************/
 #if defined(LV_SHADOW_CACHE_SIZE) && LV_SHADOW_CACHE_SIZE > 0
-    static uint8_t sh_cache[LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE];
-    static int32_t sh_cache_size = -1;
-    static int32_t sh_cache_r = -1;
+    static sh_cache_entry_t sh_cache[SHADOW_CACHE_ENTRY_CNT];
+    static uint32_t sh_cache_time;
+    static lv_draw_shadow_cache_stats_t sh_cache_stats;
 #endif
 
 /**********************
@@ -112,6 +134,20 @@ void lv_draw_rect(const lv_area_t * coords, const lv_area_t * clip, const lv_dra
     LV_ASSERT_MEM_INTEGRITY();
 }
 
+/**
+ * Get the statistics of the shadow cache
+ * @param stats store the statistics here
+ */
+void lv_draw_shadow_cache_get_stats(lv_draw_shadow_cache_stats_t * stats)
+{
+#if LV_DRAW_COMPLEX && LV_SHADOW_CACHE_SIZE
+    *stats = sh_cache_stats;
+    stats->budget = LV_SHADOW_CACHE_BUDGET;
+#else
+    lv_memset_00(stats, sizeof(lv_draw_shadow_cache_stats_t));
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -605,10 +641,19 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
     lv_opa_t * sh_buf;
 
 #if LV_SHADOW_CACHE_SIZE
-    if(sh_cache_size == corner_size && sh_cache_r == r_sh) {
+    /*Beyond these sizes the rectangle's far edges don't reach the corner buffer*/
+    lv_coord_t sh_w = lv_area_get_width(&sh_rect_area);
+    lv_coord_t sh_h = lv_area_get_height(&sh_rect_area);
+    lv_coord_t w_max = sw / 2 + 2 * r_sh + 1;
+    lv_coord_t h_max = corner_size + r_sh - sw / 2 + 1;
+    if(sh_w > w_max) sh_w = w_max;
+    if(sh_h > h_max) sh_h = h_max;
+
+    sh_cache_entry_t * cached = shadow_cache_find(corner_size, sw, r_sh, sh_w, sh_h);
+    if(cached) {
         /*Use the cache if available*/
         sh_buf = lv_mem_buf_get(corner_size * corner_size);
-        lv_memcpy(sh_buf, sh_cache, corner_size * corner_size);
+        lv_memcpy(sh_buf, cached->buf, corner_size * corner_size);
     }
     else {
         /*A larger buffer is required for calculation*/
@@ -616,10 +661,8 @@ LV_ATTRIBUTE_FAST_MEM static void draw_shadow(const lv_area_t * coords, const lv
         shadow_draw_corner_buf(&sh_rect_area, (uint16_t *)sh_buf, dsc->shadow_width, r_sh);
 
         /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(sh_cache)) {
-            lv_memcpy(sh_cache, sh_buf, corner_size * corner_size);
-            sh_cache_size = corner_size;
-            sh_cache_r = r_sh;
+        if(corner_size <= LV_SHADOW_CACHE_SIZE) {
+            shadow_cache_add(sh_buf, corner_size, sw, r_sh, sh_w, sh_h);
         }
     }
 #else
@@ -1103,6 +1146,73 @@ LV_ATTRIBUTE_FAST_MEM static void shadow_draw_corner_buf(const lv_area_t * coord
 
 }
 
+#if LV_SHADOW_CACHE_SIZE
+static sh_cache_entry_t * shadow_cache_find(lv_coord_t size, lv_coord_t sw, lv_coord_t r, lv_coord_t w, lv_coord_t h)
+{
+    sh_cache_time++;
+
+    uint32_t i;
+    for(i = 0; i < SHADOW_CACHE_ENTRY_CNT; i++) {
+        sh_cache_entry_t * e = &sh_cache[i];
+        if(e->buf && e->size == size && e->sw == sw && e->r == r && e->w == w && e->h == h) {
+            e->last_used = sh_cache_time;
+            sh_cache_stats.hits++;
+            return e;
+        }
+    }
+
+    sh_cache_stats.misses++;
+    return NULL;
+}
+
+static void shadow_cache_add(const lv_opa_t * sh_buf, lv_coord_t size, lv_coord_t sw, lv_coord_t r, lv_coord_t w,
+                             lv_coord_t h)
+{
+    uint32_t buf_size = (uint32_t)size * size;
+    if(buf_size > LV_SHADOW_CACHE_BUDGET) return;
+
+    /*Drop the least recently used corners until the new one fits and there is a free entry*/
+    while(1) {
+        sh_cache_entry_t * free_e = NULL;
+        sh_cache_entry_t * oldest = NULL;
+        uint32_t i;
+        for(i = 0; i < SHADOW_CACHE_ENTRY_CNT; i++) {
+            sh_cache_entry_t * e = &sh_cache[i];
+            if(e->buf == NULL) {
+                if(free_e == NULL) free_e = e;
+            }
+            else if(oldest == NULL || e->last_used < oldest->last_used) {
+                oldest = e;
+            }
+        }
+
+        if(free_e && sh_cache_stats.size + buf_size <= LV_SHADOW_CACHE_BUDGET) {
+            free_e->buf = lv_mem_alloc(buf_size);
+            if(free_e->buf == NULL) return;
+
+            lv_memcpy(free_e->buf, sh_buf, buf_size);
+            free_e->last_used = sh_cache_time;
+            free_e->size = size;
+            free_e->sw = sw;
+            free_e->r = r;
+            free_e->w = w;
+            free_e->h = h;
+            sh_cache_stats.size += buf_size;
+            sh_cache_stats.entries++;
+            return;
+        }
+
+        if(oldest == NULL) return;
+
+        lv_mem_free(oldest->buf);
+        oldest->buf = NULL;
+        sh_cache_stats.size -= (uint32_t)oldest->size * oldest->size;
+        sh_cache_stats.entries--;
+        sh_cache_stats.evictions++;
+    }
+}
+#endif
+
 LV_ATTRIBUTE_FAST_MEM static void shadow_blur_corner(lv_coord_t size, lv_coord_t sw, uint16_t * sh_ups_buf)
 {
     int32_t s_left = sw >> 1;
@@ -69,6 +69,18 @@ typedef struct {
     lv_opa_t shadow_opa;
 } lv_draw_rect_dsc_t;
 
+/**
+ * Statistics of the shadow cache
+ */
+typedef struct {
+    uint32_t hits;          /**< Number of shadow corners taken from the cache*/
+    uint32_t misses;        /**< Number of shadow corners blurred*/
+    uint32_t evictions;     /**< Number of corners dropped to make room for a new one*/
+    uint32_t size;          /**< Bytes of cached corners*/
+    uint32_t budget;        /**< Upper limit of `size`*/
+    uint16_t entries;       /**< Number of cached corners*/
+} lv_draw_shadow_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -85,6 +97,12 @@ LV_ATTRIBUTE_FAST_MEM void lv_draw_rect_dsc_init(lv_draw_rect_dsc_t * dsc);
  */
 void lv_draw_rect(const lv_area_t * coords, const lv_area_t * mask, const lv_draw_rect_dsc_t * dsc);
 
+/**
+ * Get the statistics of the shadow cache
+ * @param stats store the statistics here
+ */
+void lv_draw_shadow_cache_get_stats(lv_draw_shadow_cache_stats_t * stats);
+
 /**
  * Draw a pixel
  * @param point the coordinates of the point to draw
@@ -13,18 +13,15 @@
 #include "../hal/lv_hal_tick.h"
 #include "../misc/lv_gc.h"
 
+#if LV_USE_GPU_NXP_PXP
+    #include "../gpu/lv_gpu_nxp_pxp.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
-/*Decrement life with this value on every open*/
-#define LV_IMG_CACHE_AGING 1
-
-/*Boost life by this factor (multiply time_to_open with this value)*/
-#define LV_IMG_CACHE_LIFE_GAIN 1
-
-/*Don't let life to be greater than this limit because it would require a lot of time to
- * "die" from very high values*/
-#define LV_IMG_CACHE_LIFE_LIMIT 1000
+/*Marks the end of a hash chain or the LRU list*/
+#define LV_IMG_CACHE_NONE 0xFFFF
 
 /**********************
  *      TYPEDEFS
@@ -35,6 +32,17 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static bool lv_img_cache_match(const void * src1, const void * src2);
+    static uint32_t lv_img_cache_hash(const void * src, lv_color_t color, lv_opa_t recolor_opa, int32_t frame_id);
+    static void lru_unlink(uint16_t i);
+    static void lru_push_head(uint16_t i);
+    static void lru_push_tail(uint16_t i);
+    static void entry_release(uint16_t i);
+    static void entry_make_resident(uint16_t i);
+    static void entry_bake_recolor(uint16_t i);
+    static uint8_t * entry_alloc(uint16_t i, uint32_t size);
+    static void entry_free(uint8_t * buf, uint32_t size);
+    static int32_t scale_axis(int32_t x, int32_t pivot, int32_t zoom_inv);
+    static void trim_to_budget(uint32_t budget, uint16_t keep);
 #endif
 
 /**********************
@@ -42,6 +50,12 @@
  **********************/
 #if LV_IMG_CACHE_DEF_SIZE
     static uint16_t entry_cnt;
+    static uint16_t bucket_mask;
+    static uint16_t * buckets;
+    static uint16_t lru_head = LV_IMG_CACHE_NONE;
+    static uint16_t lru_tail = LV_IMG_CACHE_NONE;
+    static uint32_t cache_budget = LV_IMG_CACHE_DEF_BUDGET;
+    static lv_img_cache_stats_t cache_stats;
 #endif
 
 /**********************
@@ -61,6 +75,22 @@
  * @return pointer to the cache entry or NULL if can open the image
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id)
+{
+    return _lv_img_cache_open_recolor(src, color, LV_OPA_TRANSP, frame_id);
+}
+
+/**
+ * Open an image which will be drawn recolored with `color` and `recolor_opa`.
+ * If the budget allows the recolored pixels are computed only once and kept in the cache.
+ * `recolor_baked` of the returned entry tells whether the recoloring is already applied on the pixels.
+ * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param color the recolor color. Also the color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param recolor_opa the intensity of the recoloring
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @return pointer to the cache entry or NULL if can open the image
+ */
+_lv_img_cache_entry_t * _lv_img_cache_open_recolor(const void * src, lv_color_t color, lv_opa_t recolor_opa,
+                                                   int32_t frame_id)
 {
     /*Is the image cached?*/
     _lv_img_cache_entry_t * cached_src = NULL;
@@ -73,49 +103,40 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
 
-    /*Decrement all lifes. Make the entries older*/
+    uint32_t hash = lv_img_cache_hash(src, color, recolor_opa, frame_id);
+    uint16_t * bucket = &buckets[hash & bucket_mask];
     uint16_t i;
-    for(i = 0; i < entry_cnt; i++) {
-        if(cache[i].life > INT32_MIN + LV_IMG_CACHE_AGING) {
-            cache[i].life -= LV_IMG_CACHE_AGING;
-        }
-    }
-
-    for(i = 0; i < entry_cnt; i++) {
-        if(color.full == cache[i].dec_dsc.color.full &&
+    for(i = *bucket; i != LV_IMG_CACHE_NONE; i = cache[i].hash_next) {
+        if(hash == cache[i].hash &&
+           color.full == cache[i].dec_dsc.color.full &&
+           recolor_opa == cache[i].recolor_opa &&
            frame_id == cache[i].dec_dsc.frame_id &&
            lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            /*If opened increment its life.
-             *Image difficult to open should live longer to keep avoid frequent their recaching.
-             *Therefore increase `life` with `time_to_open`*/
-            cached_src = &cache[i];
-            cached_src->life += cached_src->dec_dsc.time_to_open * LV_IMG_CACHE_LIFE_GAIN;
-            if(cached_src->life > LV_IMG_CACHE_LIFE_LIMIT) cached_src->life = LV_IMG_CACHE_LIFE_LIMIT;
             LV_LOG_TRACE("image source found in the cache");
-            break;
+            cache_stats.hits++;
+            lru_unlink(i);
+            lru_push_head(i);
+            return &cache[i];
         }
     }
 
-    /*The image is not cached then cache it now*/
-    if(cached_src) return cached_src;
+    cache_stats.misses++;
 
-    /*Find an entry to reuse. Select the entry with the least life*/
-    cached_src = &cache[0];
-    for(i = 1; i < entry_cnt; i++) {
-        if(cache[i].life < cached_src->life) {
-            cached_src = &cache[i];
-        }
-    }
+    /*Reuse the least recently used entry. Empty entries are always kept at the end of the list*/
+    i = lru_tail;
+    cached_src = &cache[i];
 
     /*Close the decoder to reuse if it was opened (has a valid source)*/
     if(cached_src->dec_dsc.src) {
-        lv_img_decoder_close(&cached_src->dec_dsc);
+        cache_stats.evictions++;
+        entry_release(i);
         LV_LOG_INFO("image draw: cache miss, close and reuse an entry");
     }
     else {
         LV_LOG_INFO("image draw: cache miss, cached to an empty entry");
     }
 #else
+    LV_UNUSED(recolor_opa);
     cached_src = &LV_GC_ROOT(_lv_img_cache_single);
 #endif
     /*Open the image and measure the time to open*/
@@ -123,13 +144,10 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
     lv_res_t open_res = lv_img_decoder_open(&cached_src->dec_dsc, src, color, frame_id);
     if(open_res == LV_RES_INV) {
         LV_LOG_WARN("Image draw cannot open the image resource");
-        lv_memset_00(cached_src, sizeof(_lv_img_cache_entry_t));
-        cached_src->life = INT32_MIN; /*Make the empty entry very "weak" to force its us*/
+        lv_memset_00(&cached_src->dec_dsc, sizeof(lv_img_decoder_dsc_t));
         return NULL;
     }
 
-    cached_src->life = 0;
-
     /*If `time_to_open` was not set in the open function set it here*/
     if(cached_src->dec_dsc.time_to_open == 0) {
         cached_src->dec_dsc.time_to_open = lv_tick_elaps(t_start);
@@ -137,6 +155,19 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
 
     if(cached_src->dec_dsc.time_to_open == 0) cached_src->dec_dsc.time_to_open = 1;
 
+#if LV_IMG_CACHE_DEF_SIZE
+    cached_src->hash = hash;
+    cached_src->recolor_opa = recolor_opa;
+    cached_src->hash_next = *bucket;
+    *bucket = i;
+    lru_unlink(i);
+    lru_push_head(i);
+    cache_stats.entries++;
+
+    entry_make_resident(i);
+    if(recolor_opa != LV_OPA_TRANSP) entry_bake_recolor(i);
+#endif
+
     return cached_src;
 }
 
@@ -158,17 +189,151 @@ void lv_img_cache_set_size(uint16_t new_entry_cnt)
         lv_mem_free(LV_GC_ROOT(_lv_img_cache_array));
     }
 
-    /*Reallocate the cache*/
-    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt);
+    entry_cnt = 0;
+    lru_head = LV_IMG_CACHE_NONE;
+    lru_tail = LV_IMG_CACHE_NONE;
+    if(new_entry_cnt >= LV_IMG_CACHE_NONE) new_entry_cnt = LV_IMG_CACHE_NONE - 1;
+
+    /*Use at least as many hash buckets as entries*/
+    uint32_t bucket_cnt = 1;
+    while(bucket_cnt < new_entry_cnt) bucket_cnt <<= 1;
+
+    /*Reallocate the cache. The hash buckets are stored after the entries.*/
+    LV_GC_ROOT(_lv_img_cache_array) = lv_mem_alloc(sizeof(_lv_img_cache_entry_t) * new_entry_cnt +
+                                                   sizeof(uint16_t) * bucket_cnt);
     LV_ASSERT_MALLOC(LV_GC_ROOT(_lv_img_cache_array));
     if(LV_GC_ROOT(_lv_img_cache_array) == NULL) {
-        entry_cnt = 0;
         return;
     }
     entry_cnt = new_entry_cnt;
+    bucket_mask = bucket_cnt - 1;
+    buckets = (uint16_t *)&LV_GC_ROOT(_lv_img_cache_array)[entry_cnt];
 
     /*Clean the cache*/
     lv_memset_00(LV_GC_ROOT(_lv_img_cache_array), entry_cnt * sizeof(_lv_img_cache_entry_t));
+    lv_memset_ff(buckets, bucket_cnt * sizeof(uint16_t));
+
+    uint16_t i;
+    for(i = 0; i < entry_cnt; i++) lru_push_tail(i);
+
+    cache_stats.entries = 0;
+    cache_stats.max_entries = entry_cnt;
+#endif
+}
+
+/**
+ * Set how many bytes of decoded pixels the cache can keep resident.
+ * Images which can be read only line by line (e.g. `LV_IMG_CF_ALPHA_...` and `LV_IMG_CF_INDEXED_...`)
+ * are decoded once into a buffer which stays allocated while the entry is cached.
+ * The least recently used images are closed when the budget is exceeded.
+ * @param budget size in bytes. 0: don't keep decoded pixels resident
+ */
+void lv_img_cache_set_budget(uint32_t budget)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    LV_UNUSED(budget);
+    LV_LOG_WARN("Can't change cache budget because it's disabled by LV_IMG_CACHE_DEF_SIZE = 0");
+#else
+    cache_budget = budget;
+    if(entry_cnt) trim_to_budget(budget, LV_IMG_CACHE_NONE);
+#endif
+}
+
+/**
+ * Get the statistics of the image cache
+ * @param stats store the statistics here
+ */
+void lv_img_cache_get_stats(lv_img_cache_stats_t * stats)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    lv_memset_00(stats, sizeof(lv_img_cache_stats_t));
+#else
+    *stats = cache_stats;
+    stats->budget = cache_budget;
+#endif
+}
+
+/**
+ * Get a copy of a cached image scaled by `zoom` with nearest neighbor sampling.
+ * It's built on the first call and kept until the entry is closed or a different zoom or pivot is asked.
+ * A pixel of the copy takes the source pixel the non anti-aliased transformation would sample.
+ * @param entry an entry returned by `_lv_img_cache_open_recolor` with `dec_dsc.img_data` set
+ * @param zoom the zoom factor (256: no zoom)
+ * @param pivot the pivot of the zoom relative to the top left corner of the image
+ * @param area store the area of the copy here, relative to the top left corner of the image
+ * @return the pixels of the copy in the color format of `dec_dsc.header.cf` or NULL if it can't be built
+ */
+const uint8_t * _lv_img_cache_get_scaled(_lv_img_cache_entry_t * entry, uint16_t zoom, const lv_point_t * pivot,
+                                         lv_area_t * area)
+{
+#if LV_IMG_CACHE_DEF_SIZE == 0
+    LV_UNUSED(entry);
+    LV_UNUSED(zoom);
+    LV_UNUSED(pivot);
+    LV_UNUSED(area);
+    return NULL;
+#else
+    lv_img_decoder_dsc_t * dsc = &entry->dec_dsc;
+    if(cache_budget == 0 || zoom == 0 || dsc->img_data == NULL) return NULL;
+
+    if(entry->scaled && entry->scaled_zoom == zoom &&
+       entry->scaled_pivot.x == pivot->x && entry->scaled_pivot.y == pivot->y) {
+        lv_area_copy(area, &entry->scaled_area);
+        return entry->scaled;
+    }
+
+    uint32_t px_size;
+    lv_img_cf_t cf = dsc->header.cf;
+    if(cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) px_size = sizeof(lv_color_t);
+    else if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+    else return NULL;
+
+    /*Start from the transformed area and drop the rows and columns which would sample outside of the image*/
+    int32_t w = dsc->header.w;
+    int32_t h = dsc->header.h;
+    int32_t zoom_inv = (((256 * 256) << _LV_ZOOM_INV_UPSCALE) + zoom / 2) / zoom;
+    lv_area_t a;
+    _lv_img_buf_get_transformed_area(&a, w, h, 0, zoom, pivot);
+    while(a.x1 <= a.x2 && scale_axis(a.x1, pivot->x, zoom_inv) < 0) a.x1++;
+    while(a.x1 <= a.x2 && scale_axis(a.x2, pivot->x, zoom_inv) >= w) a.x2--;
+    while(a.y1 <= a.y2 && scale_axis(a.y1, pivot->y, zoom_inv) < 0) a.y1++;
+    while(a.y1 <= a.y2 && scale_axis(a.y2, pivot->y, zoom_inv) >= h) a.y2--;
+    if(a.x1 > a.x2 || a.y1 > a.y2) return NULL;
+
+    uint16_t i = entry - LV_GC_ROOT(_lv_img_cache_array);
+    if(entry->scaled) {
+        entry_free(entry->scaled, entry->scaled_size);
+        entry->scaled = NULL;
+        entry->size -= entry->scaled_size;
+        cache_stats.size -= entry->scaled_size;
+    }
+
+    uint32_t size = lv_area_get_size(&a) * px_size;
+    uint8_t * buf = entry_alloc(i, size);
+    if(buf == NULL) return NULL;
+
+    const uint8_t * src = dsc->img_data;
+    uint8_t * dest = buf;
+    int32_t x;
+    int32_t y;
+    for(y = a.y1; y <= a.y2; y++) {
+        const uint8_t * src_row = src + scale_axis(y, pivot->y, zoom_inv) * w * px_size;
+        for(x = a.x1; x <= a.x2; x++) {
+            lv_memcpy_small(dest, src_row + scale_axis(x, pivot->x, zoom_inv) * px_size, px_size);
+            dest += px_size;
+        }
+    }
+
+    entry->scaled = buf;
+    entry->scaled_size = size;
+    entry->scaled_zoom = zoom;
+    entry->scaled_pivot = *pivot;
+    entry->scaled_area = a;
+    entry->size += size;
+    cache_stats.size += size;
+
+    lv_area_copy(area, &a);
+    return buf;
 #endif
 }
 
@@ -185,12 +350,9 @@ void lv_img_cache_invalidate_src(const void * src)
 
     uint16_t i;
     for(i = 0; i < entry_cnt; i++) {
+        if(cache[i].dec_dsc.src == NULL) continue;
         if(src == NULL || lv_img_cache_match(src, cache[i].dec_dsc.src)) {
-            if(cache[i].dec_dsc.src != NULL) {
-                lv_img_decoder_close(&cache[i].dec_dsc);
-            }
-
-            lv_memset_00(&cache[i], sizeof(_lv_img_cache_entry_t));
+            entry_release(i);
         }
     }
 #endif
@@ -212,4 +374,288 @@ static bool lv_img_cache_match(const void * src1, const void * src2)
         return false;
     return strcmp(src1, src2) == 0;
 }
+
+static uint32_t lv_img_cache_hash(const void * src, lv_color_t color, lv_opa_t recolor_opa, int32_t frame_id)
+{
+    uint32_t h;
+    if(lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE) {
+        h = (uint32_t)(uintptr_t)src;
+    }
+    else {
+        /*FNV-1a of the path*/
+        const uint8_t * s = src;
+        h = 2166136261u;
+        while(*s) {
+            h ^= *s++;
+            h *= 16777619u;
+        }
+    }
+
+    h ^= (uint32_t)color.full * 0x9E3779B1u;
+    h ^= (uint32_t)recolor_opa << 24;
+    h ^= (uint32_t)frame_id * 0x85EBCA77u;
+    h ^= h >> 16;
+    h *= 0x7FEB352Du;
+    h ^= h >> 15;
+    return h;
+}
+
+static void lru_unlink(uint16_t i)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+
+    if(cache[i].lru_prev != LV_IMG_CACHE_NONE) cache[cache[i].lru_prev].lru_next = cache[i].lru_next;
+    else lru_head = cache[i].lru_next;
+
+    if(cache[i].lru_next != LV_IMG_CACHE_NONE) cache[cache[i].lru_next].lru_prev = cache[i].lru_prev;
+    else lru_tail = cache[i].lru_prev;
+}
+
+static void lru_push_head(uint16_t i)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+
+    cache[i].lru_prev = LV_IMG_CACHE_NONE;
+    cache[i].lru_next = lru_head;
+    if(lru_head != LV_IMG_CACHE_NONE) cache[lru_head].lru_prev = i;
+    else lru_tail = i;
+    lru_head = i;
+}
+
+static void lru_push_tail(uint16_t i)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+
+    cache[i].lru_next = LV_IMG_CACHE_NONE;
+    cache[i].lru_prev = lru_tail;
+    if(lru_tail != LV_IMG_CACHE_NONE) cache[lru_tail].lru_next = i;
+    else lru_head = i;
+    lru_tail = i;
+}
+
+/**
+ * Close the image of an entry, free its resident pixels and move the entry to the end of the LRU list
+ * @param i index of an entry with a valid source
+ */
+static void entry_release(uint16_t i)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+    _lv_img_cache_entry_t * e = &cache[i];
+
+    /*Remove from the hash chain*/
+    uint16_t * link = &buckets[e->hash & bucket_mask];
+    while(*link != i) link = &cache[*link].hash_next;
+    *link = e->hash_next;
+
+    /*Give back the decoder what it returned in `open`*/
+    if(e->decoded) {
+        e->dec_dsc.img_data = NULL;
+        e->dec_dsc.header.cf = e->src_cf;
+    }
+
+    lv_img_decoder_close(&e->dec_dsc);
+
+    uint32_t scaled_size = e->scaled ? e->scaled_size : 0;
+    if(e->decoded) entry_free(e->decoded, e->size - scaled_size);
+    if(e->scaled) entry_free(e->scaled, scaled_size);
+    cache_stats.size -= e->size;
+
+    lv_memset_00(&e->dec_dsc, sizeof(lv_img_decoder_dsc_t));
+    e->decoded = NULL;
+    e->scaled = NULL;
+    e->scaled_zoom = 0;
+    e->size = 0;
+    e->recolor_opa = LV_OPA_TRANSP;
+    e->recolor_baked = 0;
+    e->hash_next = LV_IMG_CACHE_NONE;
+    cache_stats.entries--;
+
+    lru_unlink(i);
+    lru_push_tail(i);
+}
+
+/**
+ * If the decoder of an entry can read the image only line by line, decode it once into a buffer
+ * and give that buffer to the drawing as `img_data`.
+ * Less recently used resident images are closed to stay in the budget.
+ * @param i index of a freshly opened entry
+ */
+static void entry_make_resident(uint16_t i)
+{
+    _lv_img_cache_entry_t * e = &LV_GC_ROOT(_lv_img_cache_array)[i];
+    lv_img_decoder_dsc_t * dsc = &e->dec_dsc;
+
+    if(cache_budget == 0 || dsc->img_data != NULL || dsc->error_msg != NULL) return;
+
+    /*The formats and pixel sizes `lv_img_decoder_read_line` returns*/
+    lv_img_cf_t cf = dsc->header.cf;
+    lv_img_cf_t decoded_cf;
+    uint32_t px_size;
+    switch(cf) {
+        case LV_IMG_CF_TRUE_COLOR:
+        case LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED:
+            decoded_cf = cf;
+            px_size = LV_COLOR_SIZE / 8;
+            break;
+        case LV_IMG_CF_TRUE_COLOR_ALPHA:
+        case LV_IMG_CF_ALPHA_1BIT:
+        case LV_IMG_CF_ALPHA_2BIT:
+        case LV_IMG_CF_ALPHA_4BIT:
+        case LV_IMG_CF_ALPHA_8BIT:
+        case LV_IMG_CF_INDEXED_1BIT:
+        case LV_IMG_CF_INDEXED_2BIT:
+        case LV_IMG_CF_INDEXED_4BIT:
+        case LV_IMG_CF_INDEXED_8BIT:
+            decoded_cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+            px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+            break;
+        default:
+            return;
+    }
+
+    uint32_t w = dsc->header.w;
+    uint32_t h = dsc->header.h;
+    uint32_t size = w * h * px_size;
+    uint8_t * buf = entry_alloc(i, size);
+    if(buf == NULL) return;
+
+    uint32_t y;
+    for(y = 0; y < h; y++) {
+        if(lv_img_decoder_read_line(dsc, 0, y, w, buf + y * w * px_size) != LV_RES_OK) {
+            lv_mem_free(buf);
+            return;
+        }
+    }
+
+    e->decoded = buf;
+    e->size += size;
+    e->src_cf = cf;
+    dsc->img_data = buf;
+    dsc->header.cf = decoded_cf;
+    cache_stats.size += size;
+}
+
+/**
+ * Apply the recoloring of an entry on its pixels so the image can be drawn as a plain (A)RGB map.
+ * Images given by the decoder as a whole (e.g. from flash) are copied first.
+ * @param i index of a freshly opened entry
+ */
+static void entry_bake_recolor(uint16_t i)
+{
+    _lv_img_cache_entry_t * e = &LV_GC_ROOT(_lv_img_cache_array)[i];
+    lv_img_decoder_dsc_t * dsc = &e->dec_dsc;
+
+    if(dsc->img_data == NULL || dsc->error_msg != NULL) return;
+
+    lv_img_cf_t cf = dsc->header.cf;
+    uint32_t px_size;
+    if(cf == LV_IMG_CF_TRUE_COLOR || cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED) px_size = sizeof(lv_color_t);
+    else if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) px_size = LV_IMG_PX_SIZE_ALPHA_BYTE;
+    else return;
+
+    uint32_t px_cnt = (uint32_t)dsc->header.w * dsc->header.h;
+    if(e->decoded == NULL) {
+        uint8_t * buf = entry_alloc(i, px_cnt * px_size);
+        if(buf == NULL) return;
+
+        lv_memcpy(buf, dsc->img_data, px_cnt * px_size);
+        e->decoded = buf;
+        e->size += px_cnt * px_size;
+        e->src_cf = cf;
+        dsc->img_data = buf;
+        cache_stats.size += px_cnt * px_size;
+    }
+
+    /*The same mixing as in `lv_draw_map`*/
+    uint16_t recolor_premult[3];
+    lv_color_premult(dsc->color, e->recolor_opa, recolor_premult);
+    lv_opa_t recolor_opa_inv = 255 - e->recolor_opa;
+    lv_color_t chroma_keyed_color = LV_COLOR_CHROMA_KEY;
+
+    uint8_t * px = e->decoded;
+    uint32_t n;
+    for(n = 0; n < px_cnt; n++, px += px_size) {
+        lv_color_t c;
+        lv_memcpy_small(&c, px, sizeof(lv_color_t));
+        if(cf == LV_IMG_CF_TRUE_COLOR_ALPHA) {
+            lv_opa_t px_opa = px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1];
+            if(px_opa == LV_OPA_TRANSP) continue;
+            c = lv_color_mix_premult(recolor_premult, c, recolor_opa_inv);
+            lv_memcpy_small(px, &c, sizeof(lv_color_t));
+            px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = px_opa;
+        }
+        else {
+            if(cf == LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED && c.full == chroma_keyed_color.full) continue;
+            c = lv_color_mix_premult(recolor_premult, c, recolor_opa_inv);
+            lv_memcpy_small(px, &c, sizeof(lv_color_t));
+        }
+    }
+
+    e->recolor_baked = 1;
+}
+
+/**
+ * Allocate a buffer for the resident pixels of an entry.
+ * Less recently used resident images are closed to stay in the budget.
+ * @param i index of the entry which will own the buffer
+ * @param size size of the buffer in bytes
+ * @return the buffer or NULL if it doesn't fit in the budget
+ */
+static uint8_t * entry_alloc(uint16_t i, uint32_t size)
+{
+    if(size == 0 || size > cache_budget) return NULL;
+
+    trim_to_budget(cache_budget - size, i);
+    if(cache_stats.size + size > cache_budget) return NULL;
+
+    return lv_mem_alloc(size);
+}
+
+/**
+ * Free a buffer of resident pixels
+ * @param buf the buffer returned by `entry_alloc`
+ * @param size size of the buffer in bytes
+ */
+static void entry_free(uint8_t * buf, uint32_t size)
+{
+#if LV_USE_GPU_NXP_PXP
+    /*A queued PXP blit may still read the pixels*/
+    lv_gpu_nxp_pxp_wait_buf(buf, size);
+#else
+    LV_UNUSED(size);
+#endif
+    lv_mem_free(buf);
+}
+
+/**
+ * Map a coordinate of a zoomed image back to the source like `_lv_img_buf_transform` does without anti-aliasing
+ * @param x coordinate in the zoomed image, relative to the top left corner of the source
+ * @param pivot the pivot of the zoom on the same axis
+ * @param zoom_inv the inverse of the zoom as computed in `_lv_img_buf_transform_init`
+ * @return coordinate in the source image
+ */
+static int32_t scale_axis(int32_t x, int32_t pivot, int32_t zoom_inv)
+{
+    int32_t xs = (((x - pivot) * zoom_inv) >> _LV_ZOOM_INV_UPSCALE) + pivot * 256;
+    return xs >> 8;
+}
+
+/**
+ * Close the least recently used resident images until at most `budget` bytes remain
+ * @param budget the number of bytes to keep
+ * @param keep index of an entry not to close or `LV_IMG_CACHE_NONE`
+ */
+static void trim_to_budget(uint32_t budget, uint16_t keep)
+{
+    _lv_img_cache_entry_t * cache = LV_GC_ROOT(_lv_img_cache_array);
+
+    while(cache_stats.size > budget) {
+        uint16_t i = lru_tail;
+        while(i != LV_IMG_CACHE_NONE && (i == keep || cache[i].size == 0)) i = cache[i].lru_prev;
+        if(i == LV_IMG_CACHE_NONE) break;
+
+        cache_stats.evictions++;
+        entry_release(i);
+    }
+}
 #endif
@@ -31,12 +31,37 @@ extern "C" {
 typedef struct {
     lv_img_decoder_dsc_t dec_dsc; /**< Image information*/
 
-    /** Count the cache entries's life. Add `time_to_open` to `life` when the entry is used.
-     * Decrement all lifes by one every in every ::lv_img_cache_open.
-     * If life == 0 the entry can be reused*/
-    int32_t life;
+    /** Resident copy of the decoded pixels if the decoder could only read the image line by line.
+     * `dec_dsc.img_data` points here while the entry is cached.*/
+    uint8_t * decoded;
+    uint8_t * scaled;       /**< Copy of the image scaled by `scaled_zoom` or NULL*/
+    uint32_t scaled_size;   /**< Size of `scaled` in bytes*/
+    lv_area_t scaled_area;  /**< Area of `scaled` relative to the top left corner of the image*/
+    lv_point_t scaled_pivot; /**< Pivot `scaled` was built with*/
+    uint16_t scaled_zoom;   /**< Zoom `scaled` was built with*/
+    uint32_t size;          /**< Size of `decoded` and `scaled` in bytes, counted against the cache budget*/
+    uint32_t hash;          /**< Hash of (src, color, recolor_opa, frame_id)*/
+    uint16_t hash_next;     /**< Next entry in the same hash bucket*/
+    uint16_t lru_prev;      /**< More recently used entry*/
+    uint16_t lru_next;      /**< Less recently used entry*/
+    uint8_t src_cf;         /**< Color format reported by the decoder before `decoded` replaced it*/
+    lv_opa_t recolor_opa;   /**< Recolor intensity the image was opened for*/
+    uint8_t recolor_baked : 1; /**< 1: `decoded` is already recolored with `dec_dsc.color` and `recolor_opa`*/
 } _lv_img_cache_entry_t;
 
+/**
+ * Statistics of the image cache
+ */
+typedef struct {
+    uint32_t hits;          /**< Number of opens served from the cache*/
+    uint32_t misses;        /**< Number of opens that needed the decoder*/
+    uint32_t evictions;     /**< Number of entries closed to make room for a new one*/
+    uint32_t size;          /**< Bytes of decoded pixels kept resident*/
+    uint32_t budget;        /**< Upper limit of `size`*/
+    uint16_t entries;       /**< Number of entries in use*/
+    uint16_t max_entries;   /**< Number of entries*/
+} lv_img_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -52,6 +77,32 @@ typedef struct {
  */
 _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, int32_t frame_id);
 
+/**
+ * Open an image which will be drawn recolored with `color` and `recolor_opa`.
+ * If the budget allows the recolored pixels are computed only once and kept in the cache.
+ * `recolor_baked` of the returned entry tells whether the recoloring is already applied on the pixels.
+ * @param src source of the image. Path to file or pointer to an `lv_img_dsc_t` variable
+ * @param color the recolor color. Also the color of the image with `LV_IMG_CF_ALPHA_...`
+ * @param recolor_opa the intensity of the recoloring
+ * @param frame_id the index of the frame. Used only with animated images, set 0 for normal images
+ * @return pointer to the cache entry or NULL if can open the image
+ */
+_lv_img_cache_entry_t * _lv_img_cache_open_recolor(const void * src, lv_color_t color, lv_opa_t recolor_opa,
+                                                   int32_t frame_id);
+
+/**
+ * Get a copy of a cached image scaled by `zoom` with nearest neighbor sampling.
+ * It's built on the first call and kept until the entry is closed or a different zoom or pivot is asked.
+ * A pixel of the copy takes the source pixel the non anti-aliased transformation would sample.
+ * @param entry an entry returned by `_lv_img_cache_open_recolor` with `dec_dsc.img_data` set
+ * @param zoom the zoom factor (256: no zoom)
+ * @param pivot the pivot of the zoom relative to the top left corner of the image
+ * @param area store the area of the copy here, relative to the top left corner of the image
+ * @return the pixels of the copy in the color format of `dec_dsc.header.cf` or NULL if it can't be built
+ */
+const uint8_t * _lv_img_cache_get_scaled(_lv_img_cache_entry_t * entry, uint16_t zoom, const lv_point_t * pivot,
+                                         lv_area_t * area);
+
 /**
  * Set the number of images to be cached.
  * More cached images mean more opened image at same time which might mean more memory usage.
@@ -60,6 +111,21 @@ _lv_img_cache_entry_t * _lv_img_cache_open(const void * src, lv_color_t color, i
  */
 void lv_img_cache_set_size(uint16_t new_slot_num);
 
+/**
+ * Set how many bytes of decoded pixels the cache can keep resident.
+ * Images which can be read only line by line (e.g. `LV_IMG_CF_ALPHA_...` and `LV_IMG_CF_INDEXED_...`)
+ * are decoded once into a buffer which stays allocated while the entry is cached.
+ * The least recently used images are closed when the budget is exceeded.
+ * @param budget size in bytes. 0: don't keep decoded pixels resident
+ */
+void lv_img_cache_set_budget(uint32_t budget);
+
+/**
+ * Get the statistics of the image cache
+ * @param stats store the statistics here
+ */
+void lv_img_cache_get_stats(lv_img_cache_stats_t * stats);
+
 /**
  * Invalidate an image source in the cache.
  * Useful if the image source is updated therefore it needs to be cached again.
@@ -12,6 +12,10 @@
 #include "../misc/lv_ll.h"
 #include "../misc/lv_gc.h"
 
+#if LV_USE_GPU_NXP_PXP
+    #include "../gpu/lv_gpu_nxp_pxp.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -172,6 +176,12 @@ lv_res_t lv_img_decoder_read_line(lv_img_decoder_dsc_t * dsc, lv_coord_t x, lv_c
  */
 void lv_img_decoder_close(lv_img_decoder_dsc_t * dsc)
 {
+#if LV_USE_GPU_NXP_PXP
+    /*Decoded pixels may still be read by a queued PXP blit, wait only for the jobs reading them*/
+    if(dsc->img_data) {
+        lv_gpu_nxp_pxp_wait_buf(dsc->img_data, lv_img_buf_get_img_size(dsc->header.w, dsc->header.h, dsc->header.cf));
+    }
+#endif
     if(dsc->decoder) {
         if(dsc->decoder->close_cb) dsc->decoder->close_cb(dsc->decoder, dsc);
 
@@ -92,8 +92,17 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
     /*Handle compressed bitmap*/
     else {
 #if LV_USE_FONT_COMPRESSED
+        /*The buffer is kept between refreshes. If it still holds this glyph there is nothing to do.*/
         static size_t last_buf_size = 0;
-        if(LV_GC_ROOT(_lv_font_decompr_buf) == NULL) last_buf_size = 0;
+        static const lv_font_fmt_txt_dsc_t * last_fdsc = NULL;
+        static uint32_t last_gid = 0;
+        if(LV_GC_ROOT(_lv_font_decompr_buf) == NULL) {
+            last_buf_size = 0;
+            last_fdsc = NULL;
+        }
+        else if(last_fdsc == fdsc && last_gid == gid) {
+            return LV_GC_ROOT(_lv_font_decompr_buf);
+        }
 
         uint32_t gsize = gdsc->box_w * gdsc->box_h;
         if(gsize == 0) return NULL;
@@ -126,6 +135,8 @@ const uint8_t * lv_font_get_bitmap_fmt_txt(const lv_font_t * font, uint32_t unic
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED ? true : false;
         decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], LV_GC_ROOT(_lv_font_decompr_buf), gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
+        last_fdsc = fdsc;
+        last_gid = gid;
         return LV_GC_ROOT(_lv_font_decompr_buf);
 #else /*!LV_USE_FONT_COMPRESSED*/
 //        LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h")
@@ -190,6 +201,7 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
 
 /**
  * Free the allocated memories.
+ * The decompression buffer of the compressed fonts is kept between refreshes, call this to release it.
  */
 void _lv_font_clean_up_fmt_txt(void)
 {
@@ -212,15 +224,16 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
     /*Check the cache first*/
-    if(fdsc->cache && letter == fdsc->cache->last_letter) return fdsc->cache->last_glyph_id;
+    uint32_t slot = letter & (LV_FONT_FMT_TXT_CACHE_LETTER_CNT - 1);
+    if(fdsc->cache && letter == fdsc->cache->letters[slot]) return fdsc->cache->glyph_ids[slot];
 
+    uint32_t glyph_id = 0;
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
         /*Relative code point*/
         uint32_t rcp = letter - fdsc->cmaps[i].range_start;
         if(rcp > fdsc->cmaps[i].range_length) continue;
-        uint32_t glyph_id = 0;
         if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
             glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
         }
@@ -249,21 +262,15 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
                 glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
             }
         }
-
-        /*Update the cache*/
-        if(fdsc->cache) {
-            fdsc->cache->last_letter = letter;
-            fdsc->cache->last_glyph_id = glyph_id;
-        }
-        return glyph_id;
+        break;
     }
 
+    /*Update the cache*/
     if(fdsc->cache) {
-        fdsc->cache->last_letter = letter;
-        fdsc->cache->last_glyph_id = 0;
+        fdsc->cache->letters[slot] = letter;
+        fdsc->cache->glyph_ids[slot] = glyph_id;
     }
-    return 0;
-
+    return glyph_id;
 }
 
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
@@ -275,6 +282,12 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+
+        /*Check the cache first*/
+        uint32_t pair = gid_left + (gid_right << 16);
+        uint32_t slot = (gid_left ^ (gid_right << 3)) & (LV_FONT_FMT_TXT_CACHE_KERN_CNT - 1);
+        if(fdsc->cache && fdsc->cache->kern_pairs[slot] == pair) return fdsc->cache->kern_values[slot];
+
         if(kdsc->glyph_ids_size == 0) {
             /*Use binary search to find the kern value.
              *The pairs are ordered left_id first, then right_id secondly.*/
@@ -305,6 +318,12 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
         else {
             /*Invalid value*/
         }
+
+        /*Update the cache*/
+        if(fdsc->cache) {
+            fdsc->cache->kern_pairs[slot] = pair;
+            fdsc->cache->kern_values[slot] = value;
+        }
     }
     else {
         /*Kern classes*/
@@ -21,6 +21,11 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/*Number of letters in the glyph id cache of a font. Must be a power of 2.*/
+#define LV_FONT_FMT_TXT_CACHE_LETTER_CNT    32
+
+/*Number of glyph pairs in the kerning cache of a font. Must be a power of 2.*/
+#define LV_FONT_FMT_TXT_CACHE_KERN_CNT      32
 
 /**********************
  *      TYPEDEFS
@@ -151,9 +156,16 @@ typedef enum {
     LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER = 1,
 } lv_font_fmt_txt_bitmap_format_t;
 
+/** Cache of the glyph id and kerning lookups. Should be zero initialized.*/
 typedef struct {
-    uint32_t last_letter;
-    uint32_t last_glyph_id;
+    /*Letters and their glyph ids, indexed by the lower bits of the letter. 0: empty slot*/
+    uint32_t letters[LV_FONT_FMT_TXT_CACHE_LETTER_CNT];
+    uint32_t glyph_ids[LV_FONT_FMT_TXT_CACHE_LETTER_CNT];
+
+    /*Kern values of glyph id pairs (`gid_left + (gid_right << 16)`). 0: empty slot.
+     *Used only with kern pairs as kern classes are looked up directly.*/
+    uint32_t kern_pairs[LV_FONT_FMT_TXT_CACHE_KERN_CNT];
+    int8_t kern_values[LV_FONT_FMT_TXT_CACHE_KERN_CNT];
 } lv_font_fmt_txt_glyph_cache_t;
 
 /*Describe store additional data for fonts*/
@@ -193,7 +205,7 @@ typedef struct {
      */
     uint16_t bitmap_format  : 2;
 
-    /*Cache the last letter and is glyph id*/
+    /*Cache the recently used letters, glyph ids and kern values*/
     lv_font_fmt_txt_glyph_cache_t * cache;
 } lv_font_fmt_txt_dsc_t;
 
@@ -222,6 +234,7 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
 
 /**
  * Free the allocated memories.
+ * The decompression buffer of the compressed fonts is kept between refreshes, call this to release it.
  */
 void _lv_font_clean_up_fmt_txt(void);
 
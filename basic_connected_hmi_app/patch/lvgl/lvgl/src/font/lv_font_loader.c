@@ -119,7 +119,12 @@ void lv_font_free(lv_font_t * font)
     if(NULL != font) {
         lv_font_fmt_txt_dsc_t * dsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
 
+        /*The next font may be loaded at the same address*/
+        _lv_glyph_cache_invalidate_font(font);
+
         if(NULL != dsc) {
+            /*The decompression buffer might still hold a glyph of this font*/
+            if(dsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) _lv_font_clean_up_fmt_txt();
 
             if(dsc->kern_classes == 0) {
                 lv_font_fmt_txt_kern_pair_t * kern_dsc =
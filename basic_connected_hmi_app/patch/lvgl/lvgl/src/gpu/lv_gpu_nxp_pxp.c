@@ -67,11 +67,50 @@
  *      TYPEDEFS
  **********************/
 
+typedef enum {
+    PXP_CACHE_CLEAN,
+    PXP_CACHE_INVALIDATE,
+    PXP_CACHE_CLEAN_INVALIDATE,
+} pxp_cache_op_t;
+
+typedef enum {
+    PXP_JOB_FILL,
+    PXP_JOB_BLIT,
+    PXP_JOB_BLIT_RECOLOR,
+} pxp_job_type_t;
+
+/** Queued PXP operation, holds everything needed to program the PXP from the interrupt*/
+typedef struct {
+    pxp_job_type_t type;
+    lv_color_t * dest;          /**< first pixel of the destination rectangle*/
+    lv_coord_t dest_width;      /**< width (stride) of destination buffer in pixels*/
+    const lv_color_t * src;     /**< first pixel of the source rectangle, NULL for fills*/
+    lv_coord_t src_width;       /**< width (stride) of source buffer in pixels*/
+    lv_coord_t width;
+    lv_coord_t height;
+    lv_color_t color;           /**< fill color or recolor value*/
+    lv_opa_t opa;
+    lv_opa_t recolor_opa;
+    bool color_key;
+    bool alpha_channel;
+    bool src_alpha;             /**< recolor keeps the alpha channel of the source*/
+} pxp_job_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
-static void lv_gpu_nxp_pxp_run(void);
+static void lv_gpu_nxp_pxp_submit(const pxp_job_t * job);
+static void lv_gpu_nxp_pxp_start(const pxp_job_t * job);
+static void lv_gpu_nxp_pxp_wait_job(uint32_t id);
+static bool lv_gpu_nxp_pxp_rect_overlaps(const lv_color_t * a, lv_coord_t a_stride, lv_coord_t a_width,
+                                         lv_coord_t a_height, const lv_color_t * b, lv_coord_t b_stride, lv_coord_t b_width,
+                                         lv_coord_t b_height);
+static uint32_t lv_gpu_nxp_pxp_cache_op(pxp_cache_op_t op, const lv_color_t * buf, lv_coord_t buf_width,
+                                        lv_coord_t width, lv_coord_t height);
+static void lv_gpu_nxp_pxp_config_fill(const pxp_job_t * job);
+static void lv_gpu_nxp_pxp_config_blit(const pxp_job_t * job);
+static void lv_gpu_nxp_pxp_config_blit_recolor(const pxp_job_t * job);
 static void lv_gpu_nxp_pxp_blit_recolor(lv_color_t * dest, lv_coord_t dest_width, const lv_color_t * src,
                                         lv_coord_t src_width,
                                         lv_coord_t copy_width, lv_coord_t copy_height, lv_opa_t opa, lv_color_t recolor, lv_opa_t recolorOpa);
@@ -92,10 +131,32 @@ static bool alphaChannelEnabledSaved = false;
 
 static lv_nxp_pxp_cfg_t pxp_cfg;
 
+static uint32_t sizeLimits[_LV_GPU_NXP_PXP_OP_NUM] = {
+    [LV_GPU_NXP_PXP_OP_FILL]     = LV_GPU_NXP_PXP_FILL_SIZE_LIMIT,
+    [LV_GPU_NXP_PXP_OP_FILL_OPA] = LV_GPU_NXP_PXP_FILL_OPA_SIZE_LIMIT,
+    [LV_GPU_NXP_PXP_OP_BLIT]     = LV_GPU_NXP_PXP_BLIT_SIZE_LIMIT,
+    [LV_GPU_NXP_PXP_OP_BLIT_OPA] = LV_GPU_NXP_PXP_BLIT_OPA_SIZE_LIMIT,
+};
+
+static uint32_t cacheMaintBytes = 0;
+static volatile uint32_t cacheMaintBytesIrq = 0;
+
+/*Job queue: jobs [jobTail, jobHead) are pending, the one at jobTail is running on the PXP.
+ *The counters are free running, a job's id is the value of jobHead when it was submitted.*/
+static pxp_job_t jobs[LV_GPU_NXP_PXP_QUEUE_SIZE];
+static volatile uint32_t jobHead = 0;
+static volatile uint32_t jobTail = 0;
+static uint32_t jobSyncs = 0;
+
 /**********************
  *      MACROS
  **********************/
 
+#define PXP_JOB(id) (&jobs[(id) % LV_GPU_NXP_PXP_QUEUE_SIZE])
+
+/** D-cache line size, the CPU must not touch a line shared with a pending job*/
+#define PXP_CACHE_LINE 32U
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -108,7 +169,7 @@ static lv_nxp_pxp_cfg_t pxp_cfg;
  */
 lv_res_t lv_gpu_nxp_pxp_init(lv_nxp_pxp_cfg_t * cfg)
 {
-    if(!cfg || !cfg->pxp_interrupt_deinit || !cfg->pxp_interrupt_init || !cfg->pxp_run) {
+    if(!cfg || !cfg->pxp_interrupt_deinit || !cfg->pxp_interrupt_init || !cfg->pxp_run || !cfg->pxp_wait) {
         LV_LOG_ERROR("PXP configuration error. Check callback pointers.");
         return LV_RES_INV;
     }
@@ -134,11 +195,143 @@ lv_res_t lv_gpu_nxp_pxp_init(lv_nxp_pxp_cfg_t * cfg)
  */
 void lv_gpu_nxp_pxp_deinit(void)
 {
+    lv_gpu_nxp_pxp_wait();
     pxp_cfg.pxp_interrupt_deinit();
     PXP_DisableInterrupts(PXP, kPXP_CompleteInterruptEnable);
     PXP_Deinit(LV_GPU_NXP_PXP_ID);
 }
 
+/**
+ * Get the number of bytes cleaned or invalidated in the D-cache for the PXP jobs since init.
+ *
+ * @return D-cache maintenance size in bytes
+ */
+uint32_t lv_gpu_nxp_pxp_get_cache_maint_bytes(void)
+{
+    return cacheMaintBytes + cacheMaintBytesIrq;
+}
+
+/**
+ * Get the minimum area (in pixels) for an operation to be handled by PXP.
+ *
+ * @param[in] op operation
+ * @return size limit in pixels
+ */
+uint32_t lv_gpu_nxp_pxp_get_size_limit(lv_gpu_nxp_pxp_op_t op)
+{
+    return sizeLimits[op];
+}
+
+/**
+ * Set the minimum area (in pixels) for an operation to be handled by PXP.
+ *
+ * @param[in] op operation
+ * @param[in] limit size limit in pixels, UINT32_MAX to always use the CPU
+ */
+void lv_gpu_nxp_pxp_set_size_limit(lv_gpu_nxp_pxp_op_t op, uint32_t limit)
+{
+    sizeLimits[op] = limit;
+}
+
+/**
+ * Get the number of PXP jobs submitted since init.
+ *
+ * @return number of fills and blits queued to the PXP
+ */
+uint32_t lv_gpu_nxp_pxp_get_job_count(void)
+{
+    return jobHead;
+}
+
+/**
+ * Get the number of times the CPU had to wait for a pending PXP job since init.
+ *
+ * @return number of synchronizations
+ */
+uint32_t lv_gpu_nxp_pxp_get_sync_count(void)
+{
+    return jobSyncs;
+}
+
+/**
+ * Wait until all queued PXP jobs are finished.
+ */
+void lv_gpu_nxp_pxp_wait(void)
+{
+    if(jobTail != jobHead) {
+        lv_gpu_nxp_pxp_wait_job(jobHead - 1);
+    }
+}
+
+/**
+ * Wait until the PXP jobs writing a rectangle of a buffer are finished.
+ * Must be called before the CPU reads or writes pixels that might be the destination of a queued job.
+ *
+ * @param[in] buf buffer
+ * @param[in] buf_width width (stride) of buffer in pixels
+ * @param[in] area rectangle in the buffer, relative to its first pixel
+ */
+void lv_gpu_nxp_pxp_wait_area(const lv_color_t * buf, lv_coord_t buf_width, const lv_area_t * area)
+{
+    const lv_color_t * first = buf + buf_width * area->y1 + area->x1;
+    lv_coord_t width = lv_area_get_width(area);
+    lv_coord_t height = lv_area_get_height(area);
+    uint32_t tail = jobTail;
+    uint32_t id;
+
+    /*Jobs finish in order, waiting for the newest overlapping one is enough*/
+    for(id = jobHead; id != tail; id--) {
+        const pxp_job_t * job = PXP_JOB(id - 1);
+        if(lv_gpu_nxp_pxp_rect_overlaps(job->dest, job->dest_width, job->width, job->height,
+                                        first, buf_width, width, height)) {
+            lv_gpu_nxp_pxp_wait_job(id - 1);
+            return;
+        }
+    }
+}
+
+/**
+ * Wait until the PXP jobs reading or writing a memory range are finished.
+ * Must be called before a buffer used by the PXP is released or reused.
+ *
+ * @param[in] buf start of the memory range
+ * @param[in] size size of the memory range in bytes
+ */
+void lv_gpu_nxp_pxp_wait_buf(const void * buf, uint32_t size)
+{
+    lv_coord_t width = (size + sizeof(lv_color_t) - 1) / sizeof(lv_color_t);
+    uint32_t tail = jobTail;
+    uint32_t id;
+
+    for(id = jobHead; id != tail; id--) {
+        const pxp_job_t * job = PXP_JOB(id - 1);
+        if(lv_gpu_nxp_pxp_rect_overlaps(job->dest, job->dest_width, job->width, job->height, buf, width, width, 1)
+           || (job->src && lv_gpu_nxp_pxp_rect_overlaps(job->src, job->src_width, job->width, job->height, buf, width,
+                                                        width, 1))) {
+            lv_gpu_nxp_pxp_wait_job(id - 1);
+            return;
+        }
+    }
+}
+
+/**
+ * Finish the running PXP job and start the next queued one.
+ * Must be called from the PXP interrupt handler when the complete flag is set.
+ */
+void lv_gpu_nxp_pxp_job_done(void)
+{
+    const pxp_job_t * job = PXP_JOB(jobTail);
+
+    /*Drop lines speculatively fetched while the PXP was writing*/
+    cacheMaintBytesIrq += lv_gpu_nxp_pxp_cache_op(PXP_CACHE_INVALIDATE, job->dest, job->dest_width, job->width,
+                                                  job->height);
+    jobTail++;
+
+    if(jobTail != jobHead) {
+        lv_gpu_nxp_pxp_start(PXP_JOB(jobTail));
+    }
+}
+
 /**
  * Fill area, with optional opacity.
  *
@@ -150,6 +343,315 @@ void lv_gpu_nxp_pxp_deinit(void)
  */
 void lv_gpu_nxp_pxp_fill(lv_color_t * dest_buf, lv_coord_t dest_width, const lv_area_t * fill_area, lv_color_t color,
                          lv_opa_t opa)
+{
+    pxp_job_t job = {
+        .type       = PXP_JOB_FILL,
+        .dest       = dest_buf + dest_width * fill_area->y1 + fill_area->x1,
+        .dest_width = dest_width,
+        .width      = lv_area_get_width(fill_area),
+        .height     = lv_area_get_height(fill_area),
+        .color      = color,
+        .opa        = opa,
+    };
+
+    lv_gpu_nxp_pxp_submit(&job);
+}
+
+/**
+ * @brief BLock Image Transfer - copy rectangular image from src buffer to dst buffer with effects.
+ *
+ * By default, image is copied directly, with optional opacity configured by \p opa.
+ * Color keying can be enabled by calling lv_gpu_nxp_pxp_enable_color_key() before calling this function.
+ * Recoloring can be enabled by calling  lv_gpu_nxp_pxp_enable_recolor() before calling this function.
+ * Note that color keying and recoloring at the same time is not supported and black rectangle is rendered.
+ *
+ * @param[in/out] dest destination buffer
+ * @param[in] dest_width width (stride) of destination buffer in pixels
+ * @param[in] src source buffer
+ * @param[in] src_with width (stride) of source buffer in pixels
+ * @param[in] copy_w width of area to be copied from src to dest
+ * @param[in] copy_h height of area to be copied from src to dest
+ * @param[in] opa opacity of the result
+ */
+void lv_gpu_nxp_pxp_blit(lv_color_t * dest, lv_coord_t dest_width, const lv_color_t * src, lv_coord_t src_width,
+                         lv_coord_t copy_width, lv_coord_t copy_height, lv_opa_t opa)
+{
+
+    if(recolorEnabled) {  /*switch to recolor version of blit*/
+        lv_gpu_nxp_pxp_blit_recolor(dest,  dest_width, src, src_width, copy_width, copy_height, opa, recolor, recolorOpa);
+        return;
+    };
+
+    pxp_job_t job = {
+        .type          = PXP_JOB_BLIT,
+        .dest          = dest,
+        .dest_width    = dest_width,
+        .src           = src,
+        .src_width     = src_width,
+        .width         = copy_width,
+        .height        = copy_height,
+        .opa           = opa,
+        .color_key     = colorKeyEnabled,
+        .alpha_channel = alphaChannelEnabled,
+    };
+
+    lv_gpu_nxp_pxp_submit(&job);
+}
+
+/**
+ * @brief Enable color keying for subsequent calls to lv_gpu_nxp_pxp_blit()
+ *
+ * Color key is defined by  symbol in lv_conf.h
+ */
+void lv_gpu_nxp_pxp_enable_color_key(void)
+{
+    colorKeyEnabled = true;
+}
+
+/**
+ * @brief Disable color keying for subsequent calls to lv_gpu_nxp_pxp_blit()
+ *
+ */
+void lv_gpu_nxp_pxp_disable_color_key(void)
+{
+    colorKeyEnabled = false;
+}
+
+/**
+ * @brief Enable recolor feature for subsequent calls to lv_gpu_nxp_pxp_blit()
+ *
+ * @param[in] color recolor value
+ * @param[in] opa effect opacity
+ */
+void lv_gpu_nxp_pxp_enable_recolor(lv_color_t color, lv_opa_t opa)
+{
+    recolorEnabled = true;
+    recolor = color;
+    recolorOpa = opa;
+
+}
+
+/**
+ * @brief Disable recolor feature for subsequent calls to lv_gpu_nxp_pxp_blit()
+ */
+void lv_gpu_nxp_pxp_disable_recolor(void)
+{
+    recolorEnabled = false;
+}
+
+/**
+ * @brief Enable per pixel alpha blending for subsequent calls to lv_gpu_nxp_pxp_blit()
+ */
+void lv_gpu_nxp_pxp_enable_alpha_channel(void)
+{
+    alphaChannelEnabled = true;
+}
+
+/**
+ * @brief Disable per pixel alpha blending for subsequent calls to lv_gpu_nxp_pxp_blit()
+ *
+ */
+void lv_gpu_nxp_pxp_disable_alpha_channel(void)
+{
+    alphaChannelEnabled = false;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * @brief Queue PXP job
+ *
+ * The job is started at once if the PXP is idle, otherwise the PXP interrupt starts it when the previous
+ * job is finished. Only the D-cache lines of the job's buffers are maintained: the source is cleaned
+ * so that the PXP reads what the CPU wrote, the destination is cleaned and invalidated before the job
+ * (no dirty line can be evicted over the result later) and invalidated again when it is finished.
+ *
+ * @param[in] job job to copy into the queue
+ */
+static void lv_gpu_nxp_pxp_submit(const pxp_job_t * job)
+{
+    /*Queue full, wait for the oldest job*/
+    if(jobHead - jobTail >= LV_GPU_NXP_PXP_QUEUE_SIZE) {
+        lv_gpu_nxp_pxp_wait_job(jobHead - LV_GPU_NXP_PXP_QUEUE_SIZE);
+    }
+
+    if(job->src && job->src != job->dest) {
+        cacheMaintBytes += lv_gpu_nxp_pxp_cache_op(PXP_CACHE_CLEAN, job->src, job->src_width, job->width, job->height);
+    }
+    cacheMaintBytes += lv_gpu_nxp_pxp_cache_op(PXP_CACHE_CLEAN_INVALIDATE, job->dest, job->dest_width, job->width,
+                                               job->height);
+
+    *PXP_JOB(jobHead) = *job;
+
+    /*The interrupt must not see the queue empty and the new job not started at the same time*/
+    NVIC_DisableIRQ(LV_GPU_NXP_PXP_IRQ_ID);
+    bool idle = (jobTail == jobHead);
+    jobHead++;
+    if(idle) {
+        lv_gpu_nxp_pxp_start(PXP_JOB(jobTail));
+    }
+    NVIC_EnableIRQ(LV_GPU_NXP_PXP_IRQ_ID);
+}
+
+/**
+ * @brief Program the PXP for a job and start it
+ *
+ * Called from task context for a job queued to an idle PXP and from the PXP interrupt for chained jobs.
+ *
+ * @param[in] job job to run
+ */
+static void lv_gpu_nxp_pxp_start(const pxp_job_t * job)
+{
+    switch(job->type) {
+        case PXP_JOB_FILL:
+            lv_gpu_nxp_pxp_config_fill(job);
+            break;
+        case PXP_JOB_BLIT:
+            lv_gpu_nxp_pxp_config_blit(job);
+            break;
+        default:
+            lv_gpu_nxp_pxp_config_blit_recolor(job);
+            break;
+    }
+
+    pxp_cfg.pxp_run(); /*Start PXP task*/
+}
+
+/**
+ * @brief Wait until a queued job is finished
+ *
+ * @param[in] id id of the job
+ */
+static void lv_gpu_nxp_pxp_wait_job(uint32_t id)
+{
+    if((int32_t)(jobTail - id) > 0) {
+        return;
+    }
+
+    jobSyncs++;
+    while((int32_t)(jobTail - id) <= 0) {
+        pxp_cfg.pxp_wait();
+    }
+}
+
+/**
+ * @brief Check if two rectangles of pixels touch a common D-cache line
+ *
+ * Rectangle \p a is extended to whole cache lines on each row. Rectangles with different strides
+ * are compared by the memory ranges they span.
+ *
+ * @param[in] a first pixel of the first rectangle
+ * @param[in] a_stride width (stride) of the first rectangle's buffer in pixels
+ * @param[in] a_width width of the first rectangle
+ * @param[in] a_height height of the first rectangle
+ * @param[in] b first pixel of the second rectangle
+ * @param[in] b_stride width (stride) of the second rectangle's buffer in pixels
+ * @param[in] b_width width of the second rectangle
+ * @param[in] b_height height of the second rectangle
+ * @return true: the CPU accessing \p b can disturb a PXP job on \p a
+ */
+static bool lv_gpu_nxp_pxp_rect_overlaps(const lv_color_t * a, lv_coord_t a_stride, lv_coord_t a_width,
+                                         lv_coord_t a_height, const lv_color_t * b, lv_coord_t b_stride, lv_coord_t b_width,
+                                         lv_coord_t b_height)
+{
+    int64_t pitch = (int64_t)a_stride * sizeof(lv_color_t);
+    int64_t a_row = (int64_t)a_width * sizeof(lv_color_t);
+    int64_t b_row = (int64_t)b_width * sizeof(lv_color_t);
+
+    /*Columns of a row of `a`, relative to the row start and extended to cache lines.
+     *Rows are aligned the same way only if the pitch is a multiple of the line size.*/
+    int64_t a_left = -(int64_t)((uint32_t)a % PXP_CACHE_LINE);
+    int64_t a_right = a_row + (int64_t)((PXP_CACHE_LINE - ((uint32_t)a + (uint32_t)a_row) % PXP_CACHE_LINE) % PXP_CACHE_LINE);
+    if(pitch % PXP_CACHE_LINE) {
+        a_left = -(int64_t)PXP_CACHE_LINE;
+        a_right = a_row + PXP_CACHE_LINE;
+    }
+
+    int64_t offset = (int64_t)(uint32_t)b - (int64_t)(uint32_t)a;
+
+    if(a_stride != b_stride || a_row + 2 * PXP_CACHE_LINE >= pitch) {
+        int64_t a_end = (a_height - 1) * pitch + a_row + PXP_CACHE_LINE;
+        int64_t b_end = offset + ((int64_t)b_height - 1) * b_stride * (int64_t)sizeof(lv_color_t) + b_row;
+        return offset < a_end && b_end > a_left;
+    }
+
+    /*Same stride: find the row of `a` where `b` starts and compare the columns on it and on its neighbours,
+     *a row of `b` can reach into the next row and the line extension of `a` into the previous one*/
+    int64_t row = offset / pitch;
+    int64_t col = offset - row * pitch;
+    if(col < 0) {
+        row--;
+        col += pitch;
+    }
+
+    int32_t i;
+    for(i = -1; i <= 2; i++) {
+        int64_t b_first = row + i;
+        int64_t b_left = col - i * pitch;
+        if(b_first > a_height - 1 || b_first + b_height - 1 < 0) continue;
+        if(b_left < a_right && b_left + b_row > a_left) return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Clean and/or invalidate the D-cache lines of a rectangle in a buffer
+ *
+ * Rows much narrower than the buffer stride are maintained one by one to skip the pixels between them.
+ *
+ * @param[in] op cache operation
+ * @param[in] buf address of the first pixel of the rectangle
+ * @param[in] buf_width width (stride) of buffer in pixels
+ * @param[in] width width of the rectangle
+ * @param[in] height height of the rectangle
+ * @return number of bytes maintained
+ */
+static uint32_t lv_gpu_nxp_pxp_cache_op(pxp_cache_op_t op, const lv_color_t * buf, lv_coord_t buf_width,
+                                        lv_coord_t width, lv_coord_t height)
+{
+    uint32_t row_size = width * sizeof(lv_color_t);
+    uint32_t pitch = buf_width * sizeof(lv_color_t);
+    uint32_t addr = (uint32_t)buf;
+    uint32_t size = row_size;
+    uint32_t total = 0;
+    lv_coord_t rows = 1;
+
+    if(height > 1 && row_size * 2 >= pitch) {
+        /*One range covers all rows*/
+        size = (height - 1) * pitch + row_size;
+    }
+    else {
+        rows = height;
+    }
+
+    for(lv_coord_t y = 0; y < rows; y++) {
+        switch(op) {
+            case PXP_CACHE_CLEAN:
+                DCACHE_CleanByRange(addr, size);
+                break;
+            case PXP_CACHE_INVALIDATE:
+                DCACHE_InvalidateByRange(addr, size);
+                break;
+            default:
+                DCACHE_CleanInvalidateByRange(addr, size);
+                break;
+        }
+        total += size;
+        addr += pitch;
+    }
+
+    return total;
+}
+
+/**
+ * @brief Program the PXP for a fill job
+ *
+ * @param[in] job fill job
+ */
+static void lv_gpu_nxp_pxp_config_fill(const pxp_job_t * job)
 {
     PXP_Init(LV_GPU_NXP_PXP_ID);
     PXP_EnableCsc1(LV_GPU_NXP_PXP_ID, false);     /*Disable CSC1, it is enabled by default.*/
@@ -159,20 +661,20 @@ void lv_gpu_nxp_pxp_fill(lv_color_t * dest_buf, lv_coord_t dest_width, const lv_
     pxp_output_buffer_config_t outputConfig = {
         .pixelFormat    = PXP_OUT_PIXEL_FORMAT,
         .interlacedMode = kPXP_OutputProgressive,
-        .buffer0Addr    = (uint32_t)(dest_buf + dest_width * fill_area->y1 + fill_area->x1),
+        .buffer0Addr    = (uint32_t)job->dest,
         .buffer1Addr    = (uint32_t)NULL,
-        .pitchBytes     = dest_width * sizeof(lv_color_t),
-        .width          = fill_area->x2 - fill_area->x1 + 1,
-        .height         = fill_area->y2 - fill_area->y1 + 1,
+        .pitchBytes     = job->dest_width * sizeof(lv_color_t),
+        .width          = job->width,
+        .height         = job->height,
     };
 
     PXP_SetOutputBufferConfig(LV_GPU_NXP_PXP_ID, &outputConfig);
 
-    if(opa > LV_OPA_MAX) {
+    if(job->opa > LV_OPA_MAX) {
         /*Simple color fill without opacity - AS disabled, PS as color generator*/
         PXP_SetAlphaSurfacePosition(LV_GPU_NXP_PXP_ID, 0xFFFFU, 0xFFFFU, 0U, 0U); /*Disable AS.*/
         PXP_SetProcessSurfacePosition(LV_GPU_NXP_PXP_ID, 0xFFFFU, 0xFFFFU, 0U, 0U); /*Disable PS.*/
-        PXP_SetProcessSurfaceBackGroundColor(LV_GPU_NXP_PXP_ID, lv_color_to32(color));
+        PXP_SetProcessSurfaceBackGroundColor(LV_GPU_NXP_PXP_ID, lv_color_to32(job->color));
     }
     else {
         /*Fill with opacity - AS used as source (same as OUT), PS used as color generator, blended together*/
@@ -185,12 +687,11 @@ void lv_gpu_nxp_pxp_fill(lv_color_t * dest_buf, lv_coord_t dest_width, const lv_
         asBufferConfig.pitchBytes  = outputConfig.pitchBytes;
 
         PXP_SetAlphaSurfaceBufferConfig(LV_GPU_NXP_PXP_ID, &asBufferConfig);
-        PXP_SetAlphaSurfacePosition(LV_GPU_NXP_PXP_ID, 0U, 0U, fill_area->x2 - fill_area->x1 + 1,
-                                    fill_area->y2 - fill_area->y1 + 1);
+        PXP_SetAlphaSurfacePosition(LV_GPU_NXP_PXP_ID, 0U, 0U, job->width, job->height);
 
         /*Disable PS, use as color generator*/
         PXP_SetProcessSurfacePosition(LV_GPU_NXP_PXP_ID, 0xFFFFU, 0xFFFFU, 0U, 0U);
-        PXP_SetProcessSurfaceBackGroundColor(LV_GPU_NXP_PXP_ID, lv_color_to32(color));
+        PXP_SetProcessSurfaceBackGroundColor(LV_GPU_NXP_PXP_ID, lv_color_to32(job->color));
 
         /* Configure Porter-Duff blending */
         pdConfig.enable = 1;
@@ -200,41 +701,21 @@ void lv_gpu_nxp_pxp_fill(lv_color_t * dest_buf, lv_coord_t dest_width, const lv_
         pdConfig.srcGlobalAlphaMode = kPXP_PorterDuffGlobalAlpha;
         pdConfig.srcFactorMode = kPXP_PorterDuffFactorStraight;
         pdConfig.dstFactorMode = kPXP_PorterDuffFactorStraight;
-        pdConfig.srcGlobalAlpha = opa;
-        pdConfig.dstGlobalAlpha = 255 - opa;
+        pdConfig.srcGlobalAlpha = job->opa;
+        pdConfig.dstGlobalAlpha = 255 - job->opa;
         pdConfig.srcAlphaMode = kPXP_PorterDuffAlphaStraight; /*don't care*/
         pdConfig.dstAlphaMode = kPXP_PorterDuffAlphaStraight; /*don't care*/
         PXP_SetPorterDuffConfig(LV_GPU_NXP_PXP_ID, &pdConfig);
     }
-
-    lv_gpu_nxp_pxp_run(); /*Start PXP task*/
 }
 
 /**
- * @brief BLock Image Transfer - copy rectangular image from src buffer to dst buffer with effects.
- *
- * By default, image is copied directly, with optional opacity configured by \p opa.
- * Color keying can be enabled by calling lv_gpu_nxp_pxp_enable_color_key() before calling this function.
- * Recoloring can be enabled by calling  lv_gpu_nxp_pxp_enable_recolor() before calling this function.
- * Note that color keying and recoloring at the same time is not supported and black rectangle is rendered.
+ * @brief Program the PXP for a blit job, with optional opacity, color keying and alpha channel
  *
- * @param[in/out] dest destination buffer
- * @param[in] dest_width width (stride) of destination buffer in pixels
- * @param[in] src source buffer
- * @param[in] src_with width (stride) of source buffer in pixels
- * @param[in] copy_w width of area to be copied from src to dest
- * @param[in] copy_h height of area to be copied from src to dest
- * @param[in] opa opacity of the result
+ * @param[in] job blit job
  */
-void lv_gpu_nxp_pxp_blit(lv_color_t * dest, lv_coord_t dest_width, const lv_color_t * src, lv_coord_t src_width,
-                         lv_coord_t copy_width, lv_coord_t copy_height, lv_opa_t opa)
+static void lv_gpu_nxp_pxp_config_blit(const pxp_job_t * job)
 {
-
-    if(recolorEnabled) {  /*switch to recolor version of blit*/
-        lv_gpu_nxp_pxp_blit_recolor(dest,  dest_width, src, src_width, copy_width, copy_height, opa, recolor, recolorOpa);
-        return;
-    };
-
     PXP_Init(PXP);
     PXP_EnableCsc1(PXP, false);     /*Disable CSC1, it is enabled by default.*/
     PXP_SetProcessBlockSize(PXP, kPXP_BlockSize16); /*block size 16x16 for higher performance*/
@@ -243,12 +724,12 @@ void lv_gpu_nxp_pxp_blit(lv_color_t * dest, lv_coord_t dest_width, const lv_colo
     pxp_as_buffer_config_t asBufferConfig;
     pxp_as_blend_config_t asBlendConfig;
 
-    asBlendConfig.alpha = opa;
+    asBlendConfig.alpha = job->opa;
     asBlendConfig.invertAlpha = false;
     asBlendConfig.alphaMode = kPXP_AlphaRop;
     asBlendConfig.ropMode = kPXP_RopMergeAs;
 
-    if(opa >= LV_OPA_MAX && !colorKeyEnabled && !alphaChannelEnabled) {
+    if(job->opa >= LV_OPA_MAX && !job->color_key && !job->alpha_channel) {
         /* Simple blit, no effect - Disable PS buffer */
         PXP_SetProcessSurfacePosition(LV_GPU_NXP_PXP_ID, 0xFFFFU, 0xFFFFU, 0U, 0U);
     }
@@ -258,125 +739,99 @@ void lv_gpu_nxp_pxp_blit(lv_color_t * dest, lv_coord_t dest_width, const lv_colo
         pxp_ps_buffer_config_t psBufferConfig = {
             .pixelFormat = PXP_PS_PIXEL_FORMAT,
             .swapByte    = false,
-            .bufferAddr  = (uint32_t)dest,
+            .bufferAddr  = (uint32_t)job->dest,
             .bufferAddrU = 0U,
             .bufferAddrV = 0U,
-            .pitchBytes  = dest_width * sizeof(lv_color_t)
+            .pitchBytes  = job->dest_width * sizeof(lv_color_t)
         };
 
-        if (opa >= LV_OPA_MAX) {
-            asBlendConfig.alphaMode = alphaChannelEnabled ? kPXP_AlphaEmbedded: kPXP_AlphaOverride;
+        if (job->opa >= LV_OPA_MAX) {
+            asBlendConfig.alphaMode = job->alpha_channel ? kPXP_AlphaEmbedded: kPXP_AlphaOverride;
         }
         else {
-            asBlendConfig.alphaMode = alphaChannelEnabled ? kPXP_AlphaMultiply : kPXP_AlphaOverride;
+            asBlendConfig.alphaMode = job->alpha_channel ? kPXP_AlphaMultiply : kPXP_AlphaOverride;
         }
         PXP_SetProcessSurfaceBufferConfig(LV_GPU_NXP_PXP_ID, &psBufferConfig);
-        PXP_SetProcessSurfacePosition(LV_GPU_NXP_PXP_ID, 0U, 0U, copy_width - 1, copy_height - 1);
+        PXP_SetProcessSurfacePosition(LV_GPU_NXP_PXP_ID, 0U, 0U, job->width - 1, job->height - 1);
     }
 
     /*AS buffer - source image*/
     asBufferConfig.pixelFormat = PXP_AS_PIXEL_FORMAT;
-    asBufferConfig.bufferAddr  = (uint32_t)src;
-    asBufferConfig.pitchBytes  = src_width * sizeof(lv_color_t);
+    asBufferConfig.bufferAddr  = (uint32_t)job->src;
+    asBufferConfig.pitchBytes  = job->src_width * sizeof(lv_color_t);
     PXP_SetAlphaSurfaceBufferConfig(LV_GPU_NXP_PXP_ID, &asBufferConfig);
-    PXP_SetAlphaSurfacePosition(LV_GPU_NXP_PXP_ID, 0U, 0U, copy_width - 1U, copy_height - 1U);
+    PXP_SetAlphaSurfacePosition(LV_GPU_NXP_PXP_ID, 0U, 0U, job->width - 1U, job->height - 1U);
     PXP_SetAlphaSurfaceBlendConfig(LV_GPU_NXP_PXP_ID, &asBlendConfig);
 
-    if(colorKeyEnabled) {
+    if(job->color_key) {
         PXP_SetAlphaSurfaceOverlayColorKey(LV_GPU_NXP_PXP_ID, colorKey, colorKey);
     }
-    PXP_EnableAlphaSurfaceOverlayColorKey(LV_GPU_NXP_PXP_ID, colorKeyEnabled);
+    PXP_EnableAlphaSurfaceOverlayColorKey(LV_GPU_NXP_PXP_ID, job->color_key);
 
     /*Output buffer.*/
     outputBufferConfig.pixelFormat    = (pxp_output_pixel_format_t)PXP_OUT_PIXEL_FORMAT;
     outputBufferConfig.interlacedMode = kPXP_OutputProgressive;
-    outputBufferConfig.buffer0Addr    = (uint32_t)dest;
+    outputBufferConfig.buffer0Addr    = (uint32_t)job->dest;
     outputBufferConfig.buffer1Addr    = (uint32_t)0U;
-    outputBufferConfig.pitchBytes     = dest_width * sizeof(lv_color_t);
-    outputBufferConfig.width          = copy_width;
-    outputBufferConfig.height         = copy_height;
+    outputBufferConfig.pitchBytes     = job->dest_width * sizeof(lv_color_t);
+    outputBufferConfig.width          = job->width;
+    outputBufferConfig.height         = job->height;
     PXP_SetOutputBufferConfig(LV_GPU_NXP_PXP_ID, &outputBufferConfig);
-
-    lv_gpu_nxp_pxp_run(); /* Start PXP task */
 }
 
 /**
- * @brief Enable color keying for subsequent calls to lv_gpu_nxp_pxp_blit()
+ * @brief Program the PXP for a recolor job with full opacity - AS source image, PS color generator, OUT destination
  *
- * Color key is defined by  symbol in lv_conf.h
+ * @param[in] job recolor job
  */
-void lv_gpu_nxp_pxp_enable_color_key(void)
+static void lv_gpu_nxp_pxp_config_blit_recolor(const pxp_job_t * job)
 {
-    colorKeyEnabled = true;
-}
-
-/**
- * @brief Disable color keying for subsequent calls to lv_gpu_nxp_pxp_blit()
- *
- */
-void lv_gpu_nxp_pxp_disable_color_key(void)
-{
-    colorKeyEnabled = false;
-}
-
-/**
- * @brief Enable recolor feature for subsequent calls to lv_gpu_nxp_pxp_blit()
- *
- * @param[in] color recolor value
- * @param[in] opa effect opacity
- */
-void lv_gpu_nxp_pxp_enable_recolor(lv_color_t color, lv_opa_t opa)
-{
-    recolorEnabled = true;
-    recolor = color;
-    recolorOpa = opa;
-
-}
-
-/**
- * @brief Disable recolor feature for subsequent calls to lv_gpu_nxp_pxp_blit()
- */
-void lv_gpu_nxp_pxp_disable_recolor(void)
-{
-    recolorEnabled = false;
-}
-
-/**
- * @brief Enable per pixel alpha blending for subsequent calls to lv_gpu_nxp_pxp_blit()
- */
-void lv_gpu_nxp_pxp_enable_alpha_channel(void)
-{
-    alphaChannelEnabled = true;
-}
+    pxp_output_buffer_config_t outputBufferConfig;
+    pxp_as_buffer_config_t asBufferConfig;
 
-/**
- * @brief Disable per pixel alpha blending for subsequent calls to lv_gpu_nxp_pxp_blit()
- *
- */
-void lv_gpu_nxp_pxp_disable_alpha_channel(void)
-{
-    alphaChannelEnabled = false;
-}
+    PXP_Init(PXP);
+    PXP_EnableCsc1(PXP, false); /*Disable CSC1, it is enabled by default.*/
+    PXP_SetProcessBlockSize(PXP, kPXP_BlockSize16); /*block size 16x16 for higher performance*/
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+    /*AS buffer - source image*/
+    asBufferConfig.pixelFormat = PXP_AS_PIXEL_FORMAT;
+    asBufferConfig.bufferAddr  = (uint32_t)job->src;
+    asBufferConfig.pitchBytes  = job->src_width * sizeof(lv_color_t);
+    PXP_SetAlphaSurfaceBufferConfig(LV_GPU_NXP_PXP_ID, &asBufferConfig);
+    PXP_SetAlphaSurfacePosition(LV_GPU_NXP_PXP_ID, 0U, 0U, job->width - 1U, job->height - 1U);
 
-/**
- * @brief Start PXP job and wait for results
- *
- * Function used internally to start PXP task according current device
- * configuration.
- */
-static void lv_gpu_nxp_pxp_run(void)
-{
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    /*Disable PS buffer, use as color generator*/
+    PXP_SetProcessSurfacePosition(LV_GPU_NXP_PXP_ID, 0xFFFFU, 0xFFFFU, 0U, 0U);
+    PXP_SetProcessSurfaceBackGroundColor(LV_GPU_NXP_PXP_ID, lv_color_to32(job->color));
 
-    if(disp && disp->driver->clean_dcache_cb) {  /* Clean & invalidate cache */
-        disp->driver->clean_dcache_cb(disp->driver);
-    }
+    /*Output buffer*/
+    outputBufferConfig.pixelFormat    = (pxp_output_pixel_format_t)PXP_OUT_PIXEL_FORMAT;
+    outputBufferConfig.interlacedMode = kPXP_OutputProgressive;
+    outputBufferConfig.buffer0Addr    = (uint32_t)job->dest;
+    outputBufferConfig.buffer1Addr    = (uint32_t)0U;
+    outputBufferConfig.pitchBytes     = job->dest_width * sizeof(lv_color_t);
+    outputBufferConfig.width          = job->width;
+    outputBufferConfig.height         = job->height;
+    PXP_SetOutputBufferConfig(LV_GPU_NXP_PXP_ID, &outputBufferConfig);
 
-    pxp_cfg.pxp_run();
+    pxp_porter_duff_config_t pdConfig;
+
+    /* Configure Porter-Duff blending */
+    pdConfig.enable = 1;
+    pdConfig.dstColorMode = kPXP_PorterDuffColorWithAlpha;
+    pdConfig.srcColorMode = kPXP_PorterDuffColorNoAlpha;
+    pdConfig.dstGlobalAlphaMode = kPXP_PorterDuffGlobalAlpha;
+    pdConfig.srcGlobalAlphaMode = job->src_alpha ? kPXP_PorterDuffLocalAlpha : kPXP_PorterDuffGlobalAlpha;
+    /* srcFactorMode and dstFactorMode are inverted in fsl_pxp.h
+     * srcFactorMode is actually applied on PS alpha value
+     * dstFactorMode is actually applied on AS alpha value */
+    pdConfig.dstFactorMode = kPXP_PorterDuffFactorStraight;
+    pdConfig.srcFactorMode = kPXP_PorterDuffFactorInversed;
+    pdConfig.srcGlobalAlpha = 255;
+    pdConfig.dstGlobalAlpha = job->recolor_opa;
+    pdConfig.srcAlphaMode = kPXP_PorterDuffAlphaStraight;
+    pdConfig.dstAlphaMode = kPXP_PorterDuffAlphaStraight; /* don't care */
+    PXP_SetPorterDuffConfig(LV_GPU_NXP_PXP_ID, &pdConfig);
 }
 
 /**
@@ -398,9 +853,6 @@ static void lv_gpu_nxp_pxp_blit_recolor(lv_color_t * dest, lv_coord_t dest_width
                                         lv_coord_t src_width,
                                         lv_coord_t copy_width, lv_coord_t copy_height, lv_opa_t opa, lv_color_t recolor, lv_opa_t recolorOpa)
 {
-    pxp_output_buffer_config_t outputBufferConfig;
-    pxp_as_buffer_config_t asBufferConfig;
-
     if(colorKeyEnabled) {
         /*should never get here, recolor & color keying not supported. Draw black box instead.*/
         const lv_area_t fill_area = {.x1 = 0, .y1 = 0, .x2 = copy_width - 1, .y2 = copy_height - 1};
@@ -411,52 +863,21 @@ static void lv_gpu_nxp_pxp_blit_recolor(lv_color_t * dest, lv_coord_t dest_width
     else {
         /* Recoloring without color keying */
         if(opa > LV_OPA_MAX && !alphaChannelEnabled) {
-            /* Recolor with full opacity - AS source image, PS color generator, OUT destination */
-            PXP_Init(PXP);
-            PXP_EnableCsc1(PXP, false); /*Disable CSC1, it is enabled by default.*/
-            PXP_SetProcessBlockSize(PXP, kPXP_BlockSize16); /*block size 16x16 for higher performance*/
-
-            /*AS buffer - source image*/
-            asBufferConfig.pixelFormat = PXP_AS_PIXEL_FORMAT;
-            asBufferConfig.bufferAddr  = (uint32_t)src;
-            asBufferConfig.pitchBytes  = src_width * sizeof(lv_color_t);
-            PXP_SetAlphaSurfaceBufferConfig(LV_GPU_NXP_PXP_ID, &asBufferConfig);
-            PXP_SetAlphaSurfacePosition(LV_GPU_NXP_PXP_ID, 0U, 0U, copy_width - 1U, copy_height - 1U);
-
-            /*Disable PS buffer, use as color generator*/
-            PXP_SetProcessSurfacePosition(LV_GPU_NXP_PXP_ID, 0xFFFFU, 0xFFFFU, 0U, 0U);
-            PXP_SetProcessSurfaceBackGroundColor(LV_GPU_NXP_PXP_ID, lv_color_to32(recolor));
-
-            /*Output buffer*/
-            outputBufferConfig.pixelFormat    = (pxp_output_pixel_format_t)PXP_OUT_PIXEL_FORMAT;
-            outputBufferConfig.interlacedMode = kPXP_OutputProgressive;
-            outputBufferConfig.buffer0Addr    = (uint32_t)dest;
-            outputBufferConfig.buffer1Addr    = (uint32_t)0U;
-            outputBufferConfig.pitchBytes     = dest_width * sizeof(lv_color_t);
-            outputBufferConfig.width          = copy_width;
-            outputBufferConfig.height         = copy_height;
-            PXP_SetOutputBufferConfig(LV_GPU_NXP_PXP_ID, &outputBufferConfig);
-
-            pxp_porter_duff_config_t pdConfig;
-
-            /* Configure Porter-Duff blending */
-            pdConfig.enable = 1;
-            pdConfig.dstColorMode = kPXP_PorterDuffColorWithAlpha;
-            pdConfig.srcColorMode = kPXP_PorterDuffColorNoAlpha;
-            pdConfig.dstGlobalAlphaMode = kPXP_PorterDuffGlobalAlpha;
-            pdConfig.srcGlobalAlphaMode = alphaChannelEnabledSaved ? kPXP_PorterDuffLocalAlpha : kPXP_PorterDuffGlobalAlpha;
-            /* srcFactorMode and dstFactorMode are inverted in fsl_pxp.h
-             * srcFactorMode is actually applied on PS alpha value
-             * dstFactorMode is actually applied on AS alpha value */
-            pdConfig.dstFactorMode = kPXP_PorterDuffFactorStraight;
-            pdConfig.srcFactorMode = kPXP_PorterDuffFactorInversed;
-            pdConfig.srcGlobalAlpha = 255;
-            pdConfig.dstGlobalAlpha = recolorOpa;
-            pdConfig.srcAlphaMode = kPXP_PorterDuffAlphaStraight;
-            pdConfig.dstAlphaMode = kPXP_PorterDuffAlphaStraight; /* don't care */
-            PXP_SetPorterDuffConfig(LV_GPU_NXP_PXP_ID, &pdConfig);
-
-            lv_gpu_nxp_pxp_run(); /* Start PXP task */
+            pxp_job_t job = {
+                .type        = PXP_JOB_BLIT_RECOLOR,
+                .dest        = dest,
+                .dest_width  = dest_width,
+                .src         = src,
+                .src_width   = src_width,
+                .width       = copy_width,
+                .height      = copy_height,
+                .color       = recolor,
+                .opa         = opa,
+                .recolor_opa = recolorOpa,
+                .src_alpha   = alphaChannelEnabledSaved,
+            };
+
+            lv_gpu_nxp_pxp_submit(&job);
         }
         else {
             /*Recolor with transparency*/
@@ -477,7 +898,7 @@ static void lv_gpu_nxp_pxp_blit_recolor(lv_color_t * dest, lv_coord_t dest_width
             lv_gpu_nxp_pxp_blit(dest, dest_width, tmpBuf, copy_width, copy_width, copy_height, opa);
             lv_gpu_nxp_pxp_enable_recolor(recolor, recolorOpa); /*restore state*/
 
-            /*Step 3: Clean-up memory*/
+            /*Step 3: Clean-up memory, it waits for the jobs still using the buffer*/
             lv_mem_buf_release(tmpBuf);
         }
     }
@@ -76,9 +76,25 @@ extern "C" {
 #define LV_GPU_NXP_PXP_FILL_OPA_SIZE_LIMIT 5000
 #endif
 
+#ifndef LV_GPU_NXP_PXP_QUEUE_SIZE
+/** Number of fills and blits that can be queued to the PXP before the CPU has to wait*/
+#define LV_GPU_NXP_PXP_QUEUE_SIZE 8
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+/**
+ * Operations sent to the PXP only above a size limit, see lv_gpu_nxp_pxp_set_size_limit().
+ */
+typedef enum {
+    LV_GPU_NXP_PXP_OP_FILL,         /**< fill with 100% opacity*/
+    LV_GPU_NXP_PXP_OP_FILL_OPA,     /**< fill with transparency*/
+    LV_GPU_NXP_PXP_OP_BLIT,         /**< image copy with 100% opacity*/
+    LV_GPU_NXP_PXP_OP_BLIT_OPA,     /**< image copy with transparency*/
+    _LV_GPU_NXP_PXP_OP_NUM
+} lv_gpu_nxp_pxp_op_t;
+
 /**
  * NXP PXP device configuration - call-backs used for
  * interrupt init/wait/deinit.
@@ -90,8 +106,12 @@ typedef struct {
     /** Callback for PXP interrupt de-initialization*/
     void (*pxp_interrupt_deinit)(void);
 
-    /** Callback that should start PXP and wait for operation complete*/
+    /** Callback that should start PXP without waiting, it is also called from the PXP interrupt
+     *  to start the next queued job. The interrupt must call lv_gpu_nxp_pxp_job_done() on completion.*/
     void (*pxp_run)(void);
+
+    /** Callback that should wait until the PXP interrupt reports a finished job*/
+    void (*pxp_wait)(void);
 } lv_nxp_pxp_cfg_t;
 
 /**********************
@@ -119,6 +139,76 @@ lv_res_t lv_gpu_nxp_pxp_init(lv_nxp_pxp_cfg_t * cfg);
  */
 void lv_gpu_nxp_pxp_deinit(void);
 
+/**
+ * Get the number of bytes cleaned or invalidated in the D-cache for the PXP jobs since init.
+ *
+ * @return D-cache maintenance size in bytes
+ */
+uint32_t lv_gpu_nxp_pxp_get_cache_maint_bytes(void);
+
+/**
+ * Get the minimum area (in pixels) for an operation to be handled by PXP.
+ *
+ * @param[in] op operation
+ * @return size limit in pixels
+ */
+uint32_t lv_gpu_nxp_pxp_get_size_limit(lv_gpu_nxp_pxp_op_t op);
+
+/**
+ * Set the minimum area (in pixels) for an operation to be handled by PXP.
+ * The limits start from LV_GPU_NXP_PXP_FILL_SIZE_LIMIT, LV_GPU_NXP_PXP_FILL_OPA_SIZE_LIMIT,
+ * LV_GPU_NXP_PXP_BLIT_SIZE_LIMIT and LV_GPU_NXP_PXP_BLIT_OPA_SIZE_LIMIT and can be tuned at runtime,
+ * e.g. from a measurement of the CPU and PXP costs on the target.
+ *
+ * @param[in] op operation
+ * @param[in] limit size limit in pixels, UINT32_MAX to always use the CPU
+ */
+void lv_gpu_nxp_pxp_set_size_limit(lv_gpu_nxp_pxp_op_t op, uint32_t limit);
+
+/**
+ * Get the number of PXP jobs submitted since init.
+ *
+ * @return number of fills and blits queued to the PXP
+ */
+uint32_t lv_gpu_nxp_pxp_get_job_count(void);
+
+/**
+ * Get the number of times the CPU had to wait for a pending PXP job since init.
+ *
+ * @return number of synchronizations
+ */
+uint32_t lv_gpu_nxp_pxp_get_sync_count(void);
+
+/**
+ * Wait until all queued PXP jobs are finished.
+ */
+void lv_gpu_nxp_pxp_wait(void);
+
+/**
+ * Wait until the PXP jobs writing a rectangle of a buffer are finished.
+ * Must be called before the CPU reads or writes pixels that might be the destination of a queued job.
+ *
+ * @param[in] buf buffer
+ * @param[in] buf_width width (stride) of buffer in pixels
+ * @param[in] area rectangle in the buffer, relative to its first pixel
+ */
+void lv_gpu_nxp_pxp_wait_area(const lv_color_t * buf, lv_coord_t buf_width, const lv_area_t * area);
+
+/**
+ * Wait until the PXP jobs reading or writing a memory range are finished.
+ * Must be called before a buffer used by the PXP is released or reused.
+ *
+ * @param[in] buf start of the memory range
+ * @param[in] size size of the memory range in bytes
+ */
+void lv_gpu_nxp_pxp_wait_buf(const void * buf, uint32_t size);
+
+/**
+ * Finish the running PXP job and start the next queued one.
+ * Must be called from the PXP interrupt handler when the complete flag is set.
+ */
+void lv_gpu_nxp_pxp_job_done(void);
+
 /**
  * Fill area, with optional opacity.
  *
@@ -58,15 +58,16 @@
 static lv_res_t _lv_gpu_nxp_pxp_interrupt_init(void);
 static void _lv_gpu_nxp_pxp_interrupt_deinit(void);
 static void _lv_gpu_nxp_pxp_run(void);
+static void _lv_gpu_nxp_pxp_wait(void);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
 #if defined(SDK_OS_FREE_RTOS)
-    static SemaphoreHandle_t s_pxpIdle;
+    static SemaphoreHandle_t s_pxpJobDone;
 #else
-    static volatile bool s_pxpIdle;
+    static volatile bool s_pxpJobDone;
 #endif
 
 /**********************
@@ -78,7 +79,7 @@ static void _lv_gpu_nxp_pxp_run(void);
  **********************/
 
 /**
- * PXP device interrupt handler. Used to check PXP task completion status.
+ * PXP device interrupt handler. Used to check PXP task completion status and to chain the queued jobs.
  */
 void PXP_IRQHandler(void)
 {
@@ -88,11 +89,12 @@ void PXP_IRQHandler(void)
 
     if(kPXP_CompleteFlag & PXP_GetStatusFlags(LV_GPU_NXP_PXP_ID)) {
         PXP_ClearStatusFlags(LV_GPU_NXP_PXP_ID, kPXP_CompleteFlag);
+        lv_gpu_nxp_pxp_job_done();
 #if defined(SDK_OS_FREE_RTOS)
-        xSemaphoreGiveFromISR(s_pxpIdle, &taskAwake);
+        xSemaphoreGiveFromISR(s_pxpJobDone, &taskAwake);
         portYIELD_FROM_ISR(taskAwake);
 #else
-        s_pxpIdle = true;
+        s_pxpJobDone = true;
 #endif
 
     }
@@ -108,14 +110,14 @@ void PXP_IRQHandler(void)
 static lv_res_t _lv_gpu_nxp_pxp_interrupt_init(void)
 {
 #if defined(SDK_OS_FREE_RTOS)
-    s_pxpIdle = xSemaphoreCreateBinary();
-    if(s_pxpIdle == NULL) {
+    s_pxpJobDone = xSemaphoreCreateBinary();
+    if(s_pxpJobDone == NULL) {
         return LV_RES_INV;
     }
 
     NVIC_SetPriority(LV_GPU_NXP_PXP_IRQ_ID, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1);
 #else
-    s_pxpIdle = true;
+    s_pxpJobDone = false;
 #endif
 
     NVIC_EnableIRQ(LV_GPU_NXP_PXP_IRQ_ID);
@@ -130,37 +132,41 @@ static void _lv_gpu_nxp_pxp_interrupt_deinit(void)
 {
     NVIC_DisableIRQ(LV_GPU_NXP_PXP_IRQ_ID);
 #if defined(SDK_OS_FREE_RTOS)
-    vSemaphoreDelete(s_pxpIdle);
+    vSemaphoreDelete(s_pxpJobDone);
 #endif
 }
 
 /**
- * Function to start PXP job. This function must wait for task complete.
+ * Function to start PXP job. It must not wait, it is also called from PXP_IRQHandler.
  */
 static void _lv_gpu_nxp_pxp_run(void)
 {
-#if !defined(SDK_OS_FREE_RTOS)
-    s_pxpIdle = false;
-#endif
-
     PXP_EnableInterrupts(LV_GPU_NXP_PXP_ID, kPXP_CompleteInterruptEnable);
     PXP_Start(LV_GPU_NXP_PXP_ID);
+}
 
+/**
+ * Function to wait until PXP_IRQHandler reports a finished job.
+ */
+static void _lv_gpu_nxp_pxp_wait(void)
+{
 #if defined(SDK_OS_FREE_RTOS)
-    if(xSemaphoreTake(s_pxpIdle, portMAX_DELAY) != pdTRUE) {
+    if(xSemaphoreTake(s_pxpJobDone, portMAX_DELAY) != pdTRUE) {
         LV_LOG_ERROR("xSemaphoreTake error. Task halted.");
         for(; ;) ;
     }
 #else
-    while(s_pxpIdle == false) {
+    while(s_pxpJobDone == false) {
     }
+    s_pxpJobDone = false;
 #endif
 }
 
 lv_nxp_pxp_cfg_t pxp_default_cfg = {
     .pxp_interrupt_init = _lv_gpu_nxp_pxp_interrupt_init,
     .pxp_interrupt_deinit = _lv_gpu_nxp_pxp_interrupt_deinit,
-    .pxp_run = _lv_gpu_nxp_pxp_run
+    .pxp_run = _lv_gpu_nxp_pxp_run,
+    .pxp_wait = _lv_gpu_nxp_pxp_wait
 };
 
 #endif /*LV_USE_GPU_NXP_PXP && LV_USE_GPU_NXP_PXP_AUTO_INIT*/
@@ -124,6 +124,11 @@ lv_disp_t * lv_disp_drv_register(lv_disp_drv_t * driver)
         LV_LOG_WARN("full_refresh requires at least screen sized draw buffer(s)")
     }
 
+    if(driver->direct_mode && driver->draw_buf->size < (uint32_t)driver->hor_res * driver->ver_res) {
+        driver->direct_mode = 0;
+        LV_LOG_WARN("direct_mode requires at least screen sized draw buffer(s)")
+    }
+
     disp->bg_color = lv_color_white();
 #if LV_COLOR_SCREEN_TRANSP
     disp->bg_opa = LV_OPA_TRANSP;
@@ -172,6 +177,11 @@ void lv_disp_drv_update(lv_disp_t * disp, lv_disp_drv_t * new_drv)
         LV_LOG_WARN("full_refresh requires at least screen sized draw buffer(s)")
     }
 
+    if(disp->driver->direct_mode && disp->driver->draw_buf->size < (uint32_t)disp->driver->hor_res * disp->driver->ver_res) {
+        disp->driver->direct_mode = 0;
+        LV_LOG_WARN("direct_mode requires at least screen sized draw buffer(s)")
+    }
+
     lv_coord_t w = lv_disp_get_hor_res(disp);
     lv_coord_t h = lv_disp_get_ver_res(disp);
     uint32_t i;
@@ -192,6 +202,7 @@ void lv_disp_drv_update(lv_disp_t * disp, lv_disp_drv_t * new_drv)
     lv_memset_00(disp->inv_areas, sizeof(disp->inv_areas));
     lv_memset_00(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+    disp->sync_p = 0;
     if(disp->act_scr != NULL) lv_obj_invalidate(disp->act_scr);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
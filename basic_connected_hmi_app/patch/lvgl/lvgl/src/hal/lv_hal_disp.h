@@ -84,6 +84,9 @@ typedef struct _lv_disp_drv_t {
     lv_disp_draw_buf_t * draw_buf;
 
     uint32_t full_refresh : 1;       /**< 1: Always make the whole screen redrawn*/
+    uint32_t direct_mode : 1;        /**< 1: Use screen-sized buffers and draw only the invalidated areas to absolute
+                                       * coordinates. With two buffers the areas changed in the previous frame are
+                                       * copied forward so both buffers stay coherent*/
     uint32_t sw_rotate : 1;          /**< 1: use software rotation (slower)*/
     uint32_t antialiasing : 1;       /**< 1: anti-aliasing is enabled on this display.*/
     uint32_t rotated : 2;            /**< 1: turn the display by 90 degree. @warning Does not update coordinates for you!*/
@@ -170,6 +173,12 @@ typedef struct _lv_disp_t {
     lv_area_t inv_areas[LV_INV_BUF_SIZE];
     uint8_t inv_area_joined[LV_INV_BUF_SIZE];
     uint16_t inv_p;
+    uint8_t inv_by_anim : 1;        /**< 1: An animation invalidated an area since the last refresh*/
+
+    /** Areas redrawn in the previous frame. In `direct_mode` with two buffers they are
+     * copied from the displayed buffer to the draw buffer before the next frame is rendered*/
+    lv_area_t sync_areas[LV_INV_BUF_SIZE];
+    uint16_t sync_p;
 
     /*Miscellaneous data*/
     uint32_t last_activity_time;        /**< Last time when there was activity on this display*/
@@ -154,6 +154,36 @@
 #endif
 #endif     /*LV_MEM_CUSTOM*/
 
+/*Size of a region split into pages of equally sized blocks. Allocations up to `LV_MEM_SLAB_MAX_SIZE` bytes
+ *(objects, style and event lists) are served from here to keep them from fragmenting the heap.
+ *The heap is used if the region is full. 0: allocate everything from the heap*/
+#ifndef LV_MEM_SLAB_SIZE
+#  ifdef CONFIG_LV_MEM_SLAB_SIZE
+#    define LV_MEM_SLAB_SIZE CONFIG_LV_MEM_SLAB_SIZE
+#  else
+#    define  LV_MEM_SLAB_SIZE    0     /*[bytes]*/
+#  endif
+#endif
+
+/*Largest allocation served from the slabs. There is a size class for every 8 bytes up to this*/
+#ifndef LV_MEM_SLAB_MAX_SIZE
+#  ifdef CONFIG_LV_MEM_SLAB_MAX_SIZE
+#    define LV_MEM_SLAB_MAX_SIZE CONFIG_LV_MEM_SLAB_MAX_SIZE
+#  else
+#    define  LV_MEM_SLAB_MAX_SIZE    72     /*[bytes]*/
+#  endif
+#endif
+
+/*Size of a fixed region serving `lv_mem_buf_get()` during a refresh. It's reset after every refresh and
+ *buffers which don't fit are allocated from the heap. 0: allocate them only from the heap*/
+#ifndef LV_MEM_BUF_ARENA_SIZE
+#  ifdef CONFIG_LV_MEM_BUF_ARENA_SIZE
+#    define LV_MEM_BUF_ARENA_SIZE CONFIG_LV_MEM_BUF_ARENA_SIZE
+#  else
+#    define  LV_MEM_BUF_ARENA_SIZE    0     /*[bytes]*/
+#  endif
+#endif
+
 /*Use the standard `memcpy` and `memset` instead of LVGL's own functions. (Might or might not be faster).*/
 #ifndef LV_MEMCPY_MEMSET_STD
 #  ifdef CONFIG_LV_MEMCPY_MEMSET_STD
@@ -250,6 +280,36 @@
 #    define  LV_SHADOW_CACHE_SIZE    0
 #  endif
 #endif
+
+/*Bytes of shadow corners the shadow cache can keep. Corners of different sized shadows are cached separately
+ *and the least recently used ones are dropped when the budget is exceeded.*/
+#ifndef LV_SHADOW_CACHE_BUDGET
+#  ifdef CONFIG_LV_SHADOW_CACHE_BUDGET
+#    define LV_SHADOW_CACHE_BUDGET CONFIG_LV_SHADOW_CACHE_BUDGET
+#  else
+#    define  LV_SHADOW_CACHE_BUDGET  (LV_SHADOW_CACHE_SIZE * LV_SHADOW_CACHE_SIZE)
+#  endif
+#endif
+
+/*Number of circle coverage tables to keep for rounded corners. 0: to disable caching
+ *A table of radius r costs about r * (r + 9) bytes. Radii above 64 are not cached.*/
+#ifndef LV_CIRCLE_CACHE_SIZE
+#  ifdef CONFIG_LV_CIRCLE_CACHE_SIZE
+#    define LV_CIRCLE_CACHE_SIZE CONFIG_LV_CIRCLE_CACHE_SIZE
+#  else
+#    define  LV_CIRCLE_CACHE_SIZE    4
+#  endif
+#endif
+
+/*Bytes of circle coverage tables the circle cache can keep.
+ *The least recently used tables are dropped when the budget is exceeded.*/
+#ifndef LV_CIRCLE_CACHE_BUDGET
+#  ifdef CONFIG_LV_CIRCLE_CACHE_BUDGET
+#    define LV_CIRCLE_CACHE_BUDGET CONFIG_LV_CIRCLE_CACHE_BUDGET
+#  else
+#    define  LV_CIRCLE_CACHE_BUDGET  (4U * 1024U)
+#  endif
+#endif
 #endif /*LV_DRAW_COMPLEX*/
 
 /*Default image cache size. Image caching keeps the images opened.
@@ -265,6 +325,48 @@
 #  endif
 #endif
 
+/*Bytes of decoded pixels the image cache can keep resident.
+ *Images which can be read only line by line (alpha, indexed or file images) are decoded once into a buffer.
+ *0: to always read them line by line*/
+#ifndef LV_IMG_CACHE_DEF_BUDGET
+#  ifdef CONFIG_LV_IMG_CACHE_DEF_BUDGET
+#    define LV_IMG_CACHE_DEF_BUDGET CONFIG_LV_IMG_CACHE_DEF_BUDGET
+#  else
+#    define  LV_IMG_CACHE_DEF_BUDGET     0
+#  endif
+#endif
+
+/*Number of glyphs to keep in the glyph cache as ready to blend 8 bit coverage maps.
+ *Labels drawing the same letters again don't need to read and unpack the font's bitmaps.
+ *0: to disable caching*/
+#ifndef LV_GLYPH_CACHE_SIZE
+#  ifdef CONFIG_LV_GLYPH_CACHE_SIZE
+#    define LV_GLYPH_CACHE_SIZE CONFIG_LV_GLYPH_CACHE_SIZE
+#  else
+#    define  LV_GLYPH_CACHE_SIZE         0
+#  endif
+#endif
+
+/*Bytes of coverage maps the glyph cache can keep. A glyph needs `box_w * box_h` bytes.
+ *The least recently used glyphs are dropped when the budget is exceeded.*/
+#ifndef LV_GLYPH_CACHE_BUDGET
+#  ifdef CONFIG_LV_GLYPH_CACHE_BUDGET
+#    define LV_GLYPH_CACHE_BUDGET CONFIG_LV_GLYPH_CACHE_BUDGET
+#  else
+#    define  LV_GLYPH_CACHE_BUDGET       (LV_GLYPH_CACHE_SIZE * 256)
+#  endif
+#endif
+
+/*Number of resolved style properties to remember per (object, part, property, state).
+ *Each entry saves walking the styles of the object. Must be a power of 2, at least 2. 0: to disable caching*/
+#ifndef LV_STYLE_CACHE_SIZE
+#  ifdef CONFIG_LV_STYLE_CACHE_SIZE
+#    define LV_STYLE_CACHE_SIZE CONFIG_LV_STYLE_CACHE_SIZE
+#  else
+#    define  LV_STYLE_CACHE_SIZE         0
+#  endif
+#endif
+
 /*Maximum buffer size to allocate for rotation. Only used if software rotation is enabled in the display driver.*/
 #ifndef LV_DISP_ROT_MAX_BUF
 #  ifdef CONFIG_LV_DISP_ROT_MAX_BUF
@@ -662,6 +764,15 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h"*/
 #  endif
 #endif
 
+/*Complier prefix for the `LV_MEM_BUF_ARENA_SIZE` array, e.g. to place it into a faster RAM*/
+#ifndef LV_ATTRIBUTE_MEM_BUF_ARENA
+#  ifdef CONFIG_LV_ATTRIBUTE_MEM_BUF_ARENA
+#    define LV_ATTRIBUTE_MEM_BUF_ARENA CONFIG_LV_ATTRIBUTE_MEM_BUF_ARENA
+#  else
+#    define  LV_ATTRIBUTE_MEM_BUF_ARENA
+#  endif
+#endif
+
 /*Place performance critical functions into a faster memory (e.g RAM)*/
 #ifndef LV_ATTRIBUTE_FAST_MEM
 #  ifdef CONFIG_LV_ATTRIBUTE_FAST_MEM
@@ -33,6 +33,7 @@
 static void anim_timer(lv_timer_t * param);
 static void anim_mark_list_change(void);
 static void anim_ready_handler(lv_anim_t * a);
+static void anim_set_idle_period(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -40,6 +41,9 @@ static void anim_ready_handler(lv_anim_t * a);
 static uint32_t last_timer_run;
 static bool anim_list_changed;
 static bool anim_run_round;
+static bool anim_stepping;
+static bool anim_inv_area_en;
+static lv_area_t anim_inv_area;
 static lv_timer_t * _lv_anim_tmr;
 
 /**********************
@@ -98,6 +102,11 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     new_anim->time_orig = a->time;
     new_anim->run_round = anim_run_round;
 
+    /*The next step adds the time elapsed since the last one to every animation.
+     *This animation starts now so don't let it skip that time.
+     *(Animations started while stepping are skipped in this round and see only the time of the next round)*/
+    if(!anim_stepping) new_anim->act_time -= (int32_t)lv_tick_elaps(last_timer_run);
+
     /*Set the start value*/
     if(new_anim->early_apply) {
         if(new_anim->get_value_cb) {
@@ -113,6 +122,9 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
      *It's important if it happens in a ready callback. (see `anim_timer`)*/
     anim_mark_list_change();
 
+    /*The timer might sleep until a delayed animation starts. Wake it for the new animation too.*/
+    lv_timer_set_period(_lv_anim_tmr, LV_DISP_DEF_REFR_PERIOD);
+
     TRACE_ANIM("finished");
     return new_anim;
 }
@@ -185,6 +197,16 @@ void lv_anim_refr_now(void)
     anim_timer(NULL);
 }
 
+bool _lv_anim_is_stepping(void)
+{
+    return anim_stepping;
+}
+
+const lv_area_t * _lv_anim_get_inv_area(void)
+{
+    return anim_inv_area_en ? &anim_inv_area : NULL;
+}
+
 int32_t lv_anim_path_linear(const lv_anim_t * a)
 {
     /*Calculate the current step*/
@@ -334,6 +356,7 @@ static void anim_timer(lv_timer_t * param)
 
     lv_anim_t * a = _lv_ll_get_head(&LV_GC_ROOT(_lv_anim_ll));
 
+    anim_stepping = true;
     while(a != NULL) {
         /*It can be set by `lv_anim_del()` typically in `end_cb`. If set then an animation delete
          * happened in `anim_ready_handler` which could make this linked list reading corrupt
@@ -364,8 +387,14 @@ static void anim_timer(lv_timer_t * param)
 
                 if(new_value != a->current_value) {
                     a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
+                    /*Apply the calculated value.
+                     *Copy the area because `exec_cb` might delete the animation.*/
+                    if(a->exec_cb) {
+                        anim_inv_area_en = a->inv_area_en;
+                        if(anim_inv_area_en) lv_area_copy(&anim_inv_area, &a->inv_area);
+                        a->exec_cb(a->var, new_value);
+                        anim_inv_area_en = false;
+                    }
                 }
 
                 /*If the time is elapsed the animation is ready*/
@@ -382,8 +411,33 @@ static void anim_timer(lv_timer_t * param)
         else
             a = _lv_ll_get_next(&LV_GC_ROOT(_lv_anim_ll), a);
     }
+    anim_stepping = false;
 
     last_timer_run = lv_tick_get();
+
+    anim_set_idle_period();
+}
+
+/**
+ * If all animations wait for their delay let the animation timer sleep until the first one starts.
+ * (If there are no animations at all the timer is already paused by `anim_mark_list_change`)
+ */
+static void anim_set_idle_period(void)
+{
+    if(_lv_anim_tmr == NULL) return;
+
+    uint32_t period = UINT32_MAX;
+    lv_anim_t * a;
+    _LV_LL_READ(&LV_GC_ROOT(_lv_anim_ll), a) {
+        if(a->act_time >= 0) {
+            period = LV_DISP_DEF_REFR_PERIOD;
+            break;
+        }
+        period = LV_MIN(period, (uint32_t)(-a->act_time));
+    }
+
+    if(period == UINT32_MAX) return;
+    lv_timer_set_period(_lv_anim_tmr, LV_MAX(period, LV_DISP_DEF_REFR_PERIOD));
 }
 
 /**
@@ -14,6 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include "../lv_conf_internal.h"
+#include "lv_area.h"
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -82,7 +83,9 @@ typedef struct _lv_anim_t {
     uint32_t playback_time;      /**< Duration of playback animation*/
     uint32_t repeat_delay;       /**< Wait before repeat*/
     uint16_t repeat_cnt;         /**< Repeat count for the animation*/
+    lv_area_t inv_area;          /**< Invalidations of `exec_cb` are clipped to this area (see `inv_area_en`)*/
     uint8_t early_apply  : 1;    /**< 1: Apply start value immediately even is there is `delay`*/
+    uint8_t inv_area_en  : 1;    /**< 1: The animation changes only `inv_area` on the screen*/
 
     /*Animation system use these - user shouldn't set*/
     uint8_t playback_now : 1; /**< Play back is in progress*/
@@ -272,6 +275,20 @@ static inline void lv_anim_set_early_apply(lv_anim_t * a, bool en)
     a->early_apply = en;
 }
 
+/**
+ * Declare the part of the screen the animation can change.
+ * While the animation is applied the invalidated areas are clipped to this area,
+ * so e.g. a scrolling or fading animation doesn't redraw the whole parent every step.
+ * Changes applied later by the layout (e.g. `lv_obj_set_x`) are not clipped.
+ * @param a         pointer to an initialized `lv_anim_t` variable
+ * @param area      the affected area in screen coordinates. NULL: don't clip the invalidations (default)
+ */
+static inline void lv_anim_set_inv_area(lv_anim_t * a, const lv_area_t * area)
+{
+    if(area) lv_area_copy(&a->inv_area, area);
+    a->inv_area_en = area ? 1 : 0;
+}
+
 /**
  * Create an animation
  * @param a         an initialized 'anim_t' variable. Not required after call.
@@ -350,6 +367,19 @@ uint32_t lv_anim_speed_to_time(uint32_t speed, int32_t start, int32_t end);
  */
 void lv_anim_refr_now(void);
 
+/**
+ * Tell whether the animation timer is applying the animations right now.
+ * Used by the display refresh to recognize the invalidations caused by the animations.
+ * @return          true: an animation step is in progress
+ */
+bool _lv_anim_is_stepping(void);
+
+/**
+ * Get the area the currently applied animation can change.
+ * @return          pointer to the area in screen coordinates or NULL if the invalidations shouldn't be clipped
+ */
+const lv_area_t * _lv_anim_get_inv_area(void);
+
 /**
  * Calculate the current value of an animation applying linear characteristic
  * @param a     pointer to an animation
@@ -13,6 +13,10 @@
 #include "lv_assert.h"
 #include <string.h>
 
+#if LV_USE_GPU_NXP_PXP
+    #include "../gpu/lv_gpu_nxp_pxp.h"
+#endif
+
 #if LV_MEM_CUSTOM != 0
     #include LV_MEM_CUSTOM_INCLUDE
 #endif
@@ -36,9 +40,34 @@
 
 #define ZERO_MEM_SENTINEL  0xa1b2c3d4
 
+#if LV_MEM_SLAB_SIZE
+#  define SLAB_CLASS_STEP  8     /*The block size of the class `i` is `(i + 1) * SLAB_CLASS_STEP`*/
+#  define SLAB_PAGE_SIZE   512   /*The region is given to the size classes in pages of this size*/
+#  define SLAB_PAGE_CNT    (LV_MEM_SLAB_SIZE / SLAB_PAGE_SIZE)
+#  define SLAB_CLASS_NONE  0xFF
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_MEM_BUF_ARENA_SIZE
+/*Header of the buffers in the arena. The data follows it aligned to `ALIGN_MASK + 1`*/
+typedef struct {
+    uint32_t prev_size; /*Size of the buffer below this one, 0 for the first buffer*/
+    uint32_t size : 31; /*Size of this buffer with the header*/
+    uint32_t used : 1;
+} arena_hdr_t;
+#endif
+
+#if LV_MEM_SLAB_SIZE
+typedef struct _slab_page_t {
+    struct _slab_page_t * prev; /*Neighbours in the class's list of pages with free blocks*/
+    struct _slab_page_t * next; /*or the next unused page*/
+    void * free_blocks;         /*The free blocks are chained by a pointer stored in them*/
+    uint16_t used_cnt;
+    uint8_t class_id;           /*`SLAB_CLASS_NONE` if the page is unused*/
+} slab_page_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -46,6 +75,17 @@
 #if LV_MEM_CUSTOM == 0
     static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
 #endif
+#if LV_MEM_SLAB_SIZE
+    static void slab_init(void);
+    static void * slab_alloc(size_t size);
+    static void slab_free(void * p);
+    static bool slab_owns(const void * p);
+    static uint32_t slab_block_size(const void * p);
+#endif
+#if LV_MEM_BUF_ARENA_SIZE
+    static void * arena_get(uint32_t size);
+    static bool arena_release(void * p);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -56,6 +96,23 @@
 
 static uint32_t zero_mem = ZERO_MEM_SENTINEL; /*Give the address of this variable if 0 byte should be allocated*/
 
+#if LV_MEM_SLAB_SIZE
+    static LV_ATTRIBUTE_LARGE_RAM_ARRAY MEM_UNIT slab_mem[SLAB_PAGE_CNT * SLAB_PAGE_SIZE / sizeof(MEM_UNIT)];
+    static slab_page_t slab_pages[SLAB_PAGE_CNT];
+    static slab_page_t * slab_partial[LV_MEM_SLAB_CLASS_CNT]; /*Pages with free blocks of each class*/
+    static slab_page_t * slab_unused;
+    static uint32_t slab_fallback_cnt;
+#endif
+
+#if LV_MEM_BUF_ARENA_SIZE
+    /*Buffers are stacked from the bottom and popped when the topmost is released*/
+    static LV_ATTRIBUTE_MEM_BUF_ARENA MEM_UNIT arena_mem[LV_MEM_BUF_ARENA_SIZE / sizeof(MEM_UNIT)];
+    static uint32_t arena_top;      /*Offset of the first free byte*/
+    static uint32_t arena_top_size; /*Size of the topmost buffer*/
+    static uint32_t arena_max_used;
+    static uint32_t arena_overflow_cnt;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -91,6 +148,10 @@ void lv_mem_init(void)
 #endif
 #endif
 
+#if LV_MEM_SLAB_SIZE
+    slab_init();
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower")
 #endif
@@ -121,10 +182,15 @@ void * lv_mem_alloc(size_t size)
         return &zero_mem;
     }
 
+    void * alloc = NULL;
+#if LV_MEM_SLAB_SIZE
+    if(size <= LV_MEM_SLAB_MAX_SIZE) alloc = slab_alloc(size);
+#endif
+
 #if LV_MEM_CUSTOM == 0
-    void * alloc = lv_tlsf_malloc(tlsf, size);
+    if(alloc == NULL) alloc = lv_tlsf_malloc(tlsf, size);
 #else
-    void * alloc = LV_MEM_CUSTOM_ALLOC(size);
+    if(alloc == NULL) alloc = LV_MEM_CUSTOM_ALLOC(size);
 #endif
 
 #if LV_MEM_ADD_JUNK
@@ -154,6 +220,16 @@ void lv_mem_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
+#if LV_MEM_SLAB_SIZE
+    if(slab_owns(data)) {
+#  if LV_MEM_ADD_JUNK
+        lv_memset(data, 0xbb, slab_block_size(data));
+#  endif
+        slab_free(data);
+        return;
+    }
+#endif
+
 #if LV_MEM_CUSTOM == 0
 #  if LV_MEM_ADD_JUNK
     lv_memset(data, 0xbb, lv_tlsf_block_size(data));
@@ -182,6 +258,20 @@ void * lv_mem_realloc(void * data_p, size_t new_size)
 
     if(data_p == &zero_mem) return lv_mem_alloc(new_size);
 
+#if LV_MEM_SLAB_SIZE
+    if(slab_owns(data_p)) {
+        uint32_t block_size = slab_block_size(data_p);
+        if(new_size <= block_size) return data_p;
+
+        void * new_p = lv_mem_alloc(new_size);
+        if(new_p == NULL) return NULL;
+        lv_memcpy(new_p, data_p, block_size);
+        slab_free(data_p);
+        MEM_TRACE("moved out of the slabs to %p", new_p);
+        return new_p;
+    }
+#endif
+
 #if LV_MEM_CUSTOM == 0
     void * new_p = lv_tlsf_realloc(tlsf, data_p, new_size);
 #else
@@ -244,6 +334,45 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
 
     MEM_TRACE("finished");
 #endif
+
+#if LV_MEM_SLAB_SIZE
+    uint32_t slab_free_size = 0;
+    for(uint32_t i = 0; i < SLAB_PAGE_CNT; i++) {
+        if(slab_pages[i].class_id == SLAB_CLASS_NONE) continue;
+        uint32_t block_size = (slab_pages[i].class_id + 1) * SLAB_CLASS_STEP;
+        mon_p->slab_used += slab_pages[i].used_cnt * block_size;
+        slab_free_size += SLAB_PAGE_SIZE - slab_pages[i].used_cnt * block_size;
+    }
+
+    mon_p->slab_size = sizeof(slab_mem);
+    mon_p->slab_fallback_cnt = slab_fallback_cnt;
+    if(slab_free_size > 0) {
+        mon_p->slab_frag_pct = (100U * slab_free_size) / (mon_p->slab_used + slab_free_size);
+    }
+#endif
+}
+
+/**
+ * Give information about a size class of the slabs
+ * @param class_id index of the size class, `0 .. LV_MEM_SLAB_CLASS_CNT - 1`
+ * @param mon_p pointer to a variable to store the result
+ */
+void lv_mem_slab_class_monitor(uint8_t class_id, lv_mem_slab_class_monitor_t * mon_p)
+{
+    lv_memset_00(mon_p, sizeof(lv_mem_slab_class_monitor_t));
+#if LV_MEM_SLAB_SIZE
+    if(class_id >= LV_MEM_SLAB_CLASS_CNT) return;
+
+    mon_p->block_size = (class_id + 1) * SLAB_CLASS_STEP;
+    for(uint32_t i = 0; i < SLAB_PAGE_CNT; i++) {
+        if(slab_pages[i].class_id != class_id) continue;
+        mon_p->page_cnt++;
+        mon_p->used_cnt += slab_pages[i].used_cnt;
+        mon_p->free_cnt += SLAB_PAGE_SIZE / mon_p->block_size - slab_pages[i].used_cnt;
+    }
+#else
+    LV_UNUSED(class_id);
+#endif
 }
 
 
@@ -257,6 +386,12 @@ void * lv_mem_buf_get(uint32_t size)
 
     MEM_TRACE("begin, getting %d bytes", size);
 
+#if LV_MEM_BUF_ARENA_SIZE
+    void * arena_buf = arena_get(size);
+    if(arena_buf) return arena_buf;
+    arena_overflow_cnt++;
+#endif
+
     /*Try to find a free buffer with suitable size*/
     int8_t i_guess = -1;
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
@@ -310,8 +445,16 @@ void lv_mem_buf_release(void * p)
 {
     MEM_TRACE("begin (address: %p)", p);
 
+#if LV_MEM_BUF_ARENA_SIZE
+    if(arena_release(p)) return;
+#endif
+
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).p == p) {
+#if LV_USE_GPU_NXP_PXP
+            /*The next user may overwrite the buffer while a queued PXP job still reads it*/
+            lv_gpu_nxp_pxp_wait_buf(p, LV_GC_ROOT(lv_mem_buf[i]).size);
+#endif
             LV_GC_ROOT(lv_mem_buf[i]).used = 0;
             return;
         }
@@ -325,6 +468,13 @@ void lv_mem_buf_release(void * p)
  */
 void lv_mem_buf_free_all(void)
 {
+#if LV_USE_GPU_NXP_PXP
+    lv_gpu_nxp_pxp_wait();
+#endif
+#if LV_MEM_BUF_ARENA_SIZE
+    arena_top = 0;
+    arena_top_size = 0;
+#endif
     for(uint8_t i = 0; i < LV_MEM_BUF_MAX_NUM; i++) {
         if(LV_GC_ROOT(lv_mem_buf[i]).p) {
             lv_mem_free(LV_GC_ROOT(lv_mem_buf[i]).p);
@@ -335,6 +485,21 @@ void lv_mem_buf_free_all(void)
     }
 }
 
+/**
+ * Get the usage of the region serving the temporal buffers
+ * @param stats pointer to a variable to store the result. All fields are 0 if `LV_MEM_BUF_ARENA_SIZE == 0`
+ */
+void lv_mem_buf_arena_get_stats(lv_mem_buf_arena_stats_t * stats)
+{
+    lv_memset_00(stats, sizeof(lv_mem_buf_arena_stats_t));
+#if LV_MEM_BUF_ARENA_SIZE
+    stats->size = sizeof(arena_mem);
+    stats->used = arena_top;
+    stats->max_used = arena_max_used;
+    stats->overflow_cnt = arena_overflow_cnt;
+#endif
+}
+
 #if LV_MEMCPY_MEMSET_STD == 0
 /**
  * Same as `memcpy` but optimized for 4 byte operation.
@@ -541,3 +706,182 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
     }
 }
 #endif
+
+#if LV_MEM_SLAB_SIZE
+/**
+ * Mark all the pages of the slab region unused
+ */
+static void slab_init(void)
+{
+    for(uint32_t i = 0; i < SLAB_PAGE_CNT; i++) {
+        slab_pages[i].prev = NULL;
+        slab_pages[i].next = i + 1 < SLAB_PAGE_CNT ? &slab_pages[i + 1] : NULL;
+        slab_pages[i].free_blocks = NULL;
+        slab_pages[i].used_cnt = 0;
+        slab_pages[i].class_id = SLAB_CLASS_NONE;
+    }
+
+    slab_unused = &slab_pages[0];
+    lv_memset_00(slab_partial, sizeof(slab_partial));
+    slab_fallback_cnt = 0;
+}
+
+/**
+ * Get a block from the size class of `size`
+ * @param size the required size, `1 .. LV_MEM_SLAB_MAX_SIZE`
+ * @return pointer to the block or NULL if the class has no free block and all pages are in use
+ */
+static void * slab_alloc(size_t size)
+{
+    uint32_t class_id = (size - 1) / SLAB_CLASS_STEP;
+    slab_page_t * page = slab_partial[class_id];
+
+    /*Give an unused page to the class and chain its blocks*/
+    if(page == NULL) {
+        page = slab_unused;
+        if(page == NULL) {
+            slab_fallback_cnt++;
+            return NULL;
+        }
+        slab_unused = page->next;
+
+        uint32_t block_size = (class_id + 1) * SLAB_CLASS_STEP;
+        uint8_t * page_start = (uint8_t *)slab_mem + (page - slab_pages) * SLAB_PAGE_SIZE;
+        void ** next_p = &page->free_blocks;
+        for(uint32_t ofs = 0; ofs + block_size <= SLAB_PAGE_SIZE; ofs += block_size) {
+            *next_p = page_start + ofs;
+            next_p = (void **)(page_start + ofs);
+        }
+        *next_p = NULL;
+
+        page->prev = NULL;
+        page->next = NULL;
+        page->class_id = class_id;
+        slab_partial[class_id] = page;
+    }
+
+    void * p = page->free_blocks;
+    page->free_blocks = *(void **)p;
+    page->used_cnt++;
+
+    /*Full pages are not searched for free blocks*/
+    if(page->free_blocks == NULL) {
+        slab_partial[class_id] = page->next;
+        if(page->next) page->next->prev = NULL;
+        page->next = NULL;
+    }
+
+    MEM_TRACE("allocated from the slabs at %p", p);
+    return p;
+}
+
+/**
+ * Give back a block to its page
+ * @param p pointer to a block allocated by `slab_alloc`
+ */
+static void slab_free(void * p)
+{
+    slab_page_t * page = &slab_pages[((uint8_t *)p - (uint8_t *)slab_mem) / SLAB_PAGE_SIZE];
+    uint32_t class_id = page->class_id;
+
+    /*A full page has free blocks again*/
+    if(page->free_blocks == NULL) {
+        page->prev = NULL;
+        page->next = slab_partial[class_id];
+        if(page->next) page->next->prev = page;
+        slab_partial[class_id] = page;
+    }
+
+    *(void **)p = page->free_blocks;
+    page->free_blocks = p;
+    page->used_cnt--;
+
+    /*Let the other classes use the empty pages. Keep the last one of the class to not chain it again and again*/
+    if(page->used_cnt == 0 && (page->prev || page->next)) {
+        if(page->prev) page->prev->next = page->next;
+        else slab_partial[class_id] = page->next;
+        if(page->next) page->next->prev = page->prev;
+
+        page->prev = NULL;
+        page->next = slab_unused;
+        page->free_blocks = NULL;
+        page->class_id = SLAB_CLASS_NONE;
+        slab_unused = page;
+    }
+}
+
+/**
+ * Tell whether a memory was allocated from the slabs
+ * @param p pointer to an allocated memory
+ * @return true: `p` is in the slab region
+ */
+static bool slab_owns(const void * p)
+{
+    return (const uint8_t *)p >= (const uint8_t *)slab_mem && (const uint8_t *)p < (const uint8_t *)slab_mem + sizeof(slab_mem);
+}
+
+/**
+ * Get the size of a slab block
+ * @param p pointer to a block allocated by `slab_alloc`
+ * @return the size of the block
+ */
+static uint32_t slab_block_size(const void * p)
+{
+    const slab_page_t * page = &slab_pages[((const uint8_t *)p - (const uint8_t *)slab_mem) / SLAB_PAGE_SIZE];
+    return (page->class_id + 1) * SLAB_CLASS_STEP;
+}
+#endif
+
+#if LV_MEM_BUF_ARENA_SIZE
+/**
+ * Stack a new buffer on the top of the arena
+ * @param size the required size
+ * @return pointer to the buffer or NULL if it doesn't fit
+ */
+static void * arena_get(uint32_t size)
+{
+    uint32_t block_size = sizeof(arena_hdr_t) + ((size + ALIGN_MASK) & ~ALIGN_MASK);
+    if(block_size > sizeof(arena_mem) - arena_top) return NULL;
+
+    arena_hdr_t * hdr = (arena_hdr_t *)((uint8_t *)arena_mem + arena_top);
+    hdr->prev_size = arena_top_size;
+    hdr->size = block_size;
+    hdr->used = 1;
+
+    arena_top += block_size;
+    arena_top_size = block_size;
+    if(arena_top > arena_max_used) arena_max_used = arena_top;
+
+    MEM_TRACE("returning arena buffer (address: %p)", hdr + 1);
+    return hdr + 1;
+}
+
+/**
+ * Release a buffer of the arena
+ * @param p buffer to release
+ * @return true: `p` was in the arena; false: `p` is not an arena buffer
+ */
+static bool arena_release(void * p)
+{
+    uint8_t * arena_start = (uint8_t *)arena_mem;
+    if((uint8_t *)p < arena_start || (uint8_t *)p >= arena_start + sizeof(arena_mem)) return false;
+
+    arena_hdr_t * hdr = (arena_hdr_t *)p - 1;
+#if LV_USE_GPU_NXP_PXP
+    /*The next user may overwrite the buffer while a queued PXP job still reads it*/
+    lv_gpu_nxp_pxp_wait_buf(p, hdr->size - sizeof(arena_hdr_t));
+#endif
+    hdr->used = 0;
+
+    /*Buffers are usually released in reverse order, so typically only the released buffer is popped.
+     *The ones released out of order are popped when they get to the top.*/
+    while(arena_top > 0) {
+        arena_hdr_t * top = (arena_hdr_t *)(arena_start + arena_top - arena_top_size);
+        if(top->used) break;
+        arena_top -= arena_top_size;
+        arena_top_size = top->prev_size;
+    }
+
+    return true;
+}
+#endif
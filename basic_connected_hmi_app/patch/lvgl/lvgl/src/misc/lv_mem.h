@@ -32,6 +32,12 @@ extern "C" {
 #define LV_MEM_BUF_MAX_NUM    16
 #endif
 
+#if LV_MEM_SLAB_SIZE
+#define LV_MEM_SLAB_CLASS_CNT   ((LV_MEM_SLAB_MAX_SIZE + 7) / 8)
+#else
+#define LV_MEM_SLAB_CLASS_CNT   0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,8 +54,22 @@ typedef struct {
     uint32_t max_used; /**< Max size of Heap memory used*/
     uint8_t used_pct; /**< Percentage used*/
     uint8_t frag_pct; /**< Amount of fragmentation*/
+    uint32_t slab_size; /**< Size of the slab region*/
+    uint32_t slab_used; /**< Size of the slab blocks in use*/
+    uint32_t slab_fallback_cnt; /**< Number of small allocations served by the heap because the slabs were full*/
+    uint8_t slab_frag_pct; /**< Free blocks in the pages already given to a size class*/
 } lv_mem_monitor_t;
 
+/**
+ * Occupancy of a slab size class.
+ */
+typedef struct {
+    uint16_t block_size; /**< Size of the blocks of the class*/
+    uint16_t page_cnt;   /**< Number of pages given to the class*/
+    uint16_t used_cnt;   /**< Number of blocks in use*/
+    uint16_t free_cnt;   /**< Number of free blocks in the pages of the class*/
+} lv_mem_slab_class_monitor_t;
+
 typedef struct {
     void * p;
     uint16_t size;
@@ -58,6 +78,16 @@ typedef struct {
 
 typedef lv_mem_buf_t lv_mem_buf_arr_t[LV_MEM_BUF_MAX_NUM];
 
+/**
+ * Usage of the `LV_MEM_BUF_ARENA_SIZE` region serving `lv_mem_buf_get()`.
+ */
+typedef struct {
+    uint32_t size;          /**< Size of the region*/
+    uint32_t used;          /**< Currently used bytes*/
+    uint32_t max_used;      /**< Most bytes used at once since start-up*/
+    uint32_t overflow_cnt;  /**< Number of buffers allocated from the heap because the region was full*/
+} lv_mem_buf_arena_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -108,6 +138,13 @@ lv_res_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+/**
+ * Give information about a size class of the slabs
+ * @param class_id index of the size class, `0 .. LV_MEM_SLAB_CLASS_CNT - 1`
+ * @param mon_p pointer to a variable to store the result
+ */
+void lv_mem_slab_class_monitor(uint8_t class_id, lv_mem_slab_class_monitor_t * mon_p);
+
 
 /**
  * Get a temporal buffer with the given size.
@@ -126,6 +163,12 @@ void lv_mem_buf_release(void * p);
  */
 void lv_mem_buf_free_all(void);
 
+/**
+ * Get the usage of the region serving the temporal buffers
+ * @param stats pointer to a variable to store the result. All fields are 0 if `LV_MEM_BUF_ARENA_SIZE == 0`
+ */
+void lv_mem_buf_arena_get_stats(lv_mem_buf_arena_stats_t * stats);
+
 //! @cond Doxygen_Suppress
 
 #if LV_MEMCPY_MEMSET_STD
@@ -16,6 +16,7 @@
  *********************/
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
+#define HEAP_DEF_SIZE 8
 
 /**********************
  *      TYPEDEFS
@@ -26,6 +27,13 @@
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+static bool heap_is_before(const lv_timer_t * a, const lv_timer_t * b);
+static bool heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_update(lv_timer_t * timer);
+static void heap_set(uint32_t idx, lv_timer_t * timer);
+static void heap_sift_up(uint32_t idx);
+static void heap_sift_down(uint32_t idx);
 
 /**********************
  *  STATIC VARIABLES
@@ -33,7 +41,13 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
 static bool timer_deleted;
-static bool timer_created;
+
+/*`_lv_timer_heap` is a binary min-heap of the not paused timers ordered by deadline (`last_run + period`).
+ *The timers which already ran in the current `lv_timer_handler()` call are stored after the heap
+ *until the end of the call*/
+static uint32_t heap_cnt;
+static uint32_t heap_ran_cnt;
+static uint32_t heap_size;
 
 /**********************
  *      MACROS
@@ -55,6 +69,11 @@ void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
 
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    heap_ran_cnt = 0;
+    heap_size = 0;
+
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
 }
@@ -92,41 +111,38 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    do {
-        timer_deleted             = false;
-        timer_created             = false;
-        LV_GC_ROOT(_lv_timer_act) = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-        while(LV_GC_ROOT(_lv_timer_act)) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), LV_GC_ROOT(_lv_timer_act));
-
-            if(lv_timer_exec(LV_GC_ROOT(_lv_timer_act))) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
-                if(timer_created || timer_deleted) {
-                    TIMER_TRACE("Start from the first timer again because a timer was created or deleted");
-                    break;
-                }
-            }
-
-            LV_GC_ROOT(_lv_timer_act) = next; /*Load the next timer*/
+    /*Run the ready timers in the order of their deadlines.
+     *A timer which ran is moved behind the heap so it runs at most once in a call*/
+    while(heap_cnt > 0) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        if(lv_timer_time_remaining(timer) != 0) break;
+
+        heap_cnt--;
+        heap_ran_cnt++;
+        lv_timer_t * last = LV_GC_ROOT(_lv_timer_heap)[heap_cnt];
+        heap_set(heap_cnt, timer);
+        if(heap_cnt > 0) {
+            heap_set(0, last);
+            heap_sift_down(0);
         }
-    } while(LV_GC_ROOT(_lv_timer_act));
 
-    uint32_t time_till_next = LV_NO_TIMER_READY;
-    next = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_till_next)
-                time_till_next = delay;
-        }
+        timer_deleted             = false;
+        LV_GC_ROOT(_lv_timer_act) = timer;
+        lv_timer_exec(timer);
+    }
+    LV_GC_ROOT(_lv_timer_act) = NULL;
 
-        next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
+    /*Schedule the timers which ran with their new deadlines*/
+    while(heap_ran_cnt > 0) {
+        heap_ran_cnt--;
+        heap_cnt++;
+        heap_sift_up(heap_cnt - 1);
     }
 
+    /*The earliest deadline is on the top of the heap*/
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    if(heap_cnt > 0) time_till_next = lv_timer_time_remaining(LV_GC_ROOT(_lv_timer_heap)[0]);
+
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
     if(idle_period_time >= IDLE_MEAS_PERIOD) {
@@ -175,7 +191,11 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
 
-    timer_created = true;
+    if(!heap_insert(new_timer)) {
+        _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), new_timer);
+        lv_mem_free(new_timer);
+        return NULL;
+    }
 
     return new_timer;
 }
@@ -196,6 +216,7 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
  */
 void lv_timer_del(lv_timer_t * timer)
 {
+    if(!timer->paused) heap_remove(timer);
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
     timer_deleted = true;
 
@@ -208,12 +229,18 @@ void lv_timer_del(lv_timer_t * timer)
  */
 void lv_timer_pause(lv_timer_t * timer)
 {
+    if(timer->paused) return;
+
+    heap_remove(timer);
     timer->paused = true;
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
-    timer->paused = false;
+    if(!timer->paused) return;
+
+    /*If there is no memory to schedule it the timer remains paused*/
+    if(heap_insert(timer)) timer->paused = false;
 }
 
 /**
@@ -224,6 +251,7 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+    heap_update(timer);
 }
 
 /**
@@ -233,6 +261,7 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+    heap_update(timer);
 }
 
 /**
@@ -243,6 +272,9 @@ void lv_timer_ready(lv_timer_t * timer)
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+
+    /*Stopped timers are deleted in the next `lv_timer_handler()` call*/
+    if(repeat_count == 0) lv_timer_ready(timer);
 }
 
 /**
@@ -253,6 +285,7 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+    heap_update(timer);
 }
 
 /**
@@ -342,3 +375,116 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+/**
+ * Tell whether a timer has to run before an other one.
+ * The deadlines are compared as signed differences to handle the overflow of the tick.
+ */
+static bool heap_is_before(const lv_timer_t * a, const lv_timer_t * b)
+{
+    return (int32_t)((a->last_run + a->period) - (b->last_run + b->period)) < 0;
+}
+
+/**
+ * Add a timer to the heap of the scheduled timers
+ * @param timer pointer to a timer which is not in the heap yet
+ * @return true: scheduled, false: out of memory
+ */
+static bool heap_insert(lv_timer_t * timer)
+{
+    if(heap_cnt + heap_ran_cnt >= heap_size) {
+        uint32_t new_size = heap_size == 0 ? HEAP_DEF_SIZE : heap_size * 2;
+        lv_timer_t ** new_heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return false;
+
+        LV_GC_ROOT(_lv_timer_heap) = new_heap;
+        heap_size = new_size;
+    }
+
+    /*Make room after the heap by moving the first timer which already ran to the end*/
+    if(heap_ran_cnt > 0) heap_set(heap_cnt + heap_ran_cnt, LV_GC_ROOT(_lv_timer_heap)[heap_cnt]);
+
+    heap_set(heap_cnt, timer);
+    heap_cnt++;
+    heap_sift_up(heap_cnt - 1);
+
+    return true;
+}
+
+/**
+ * Remove a timer from the heap of the scheduled timers
+ * @param timer pointer to a timer in the heap or among the timers which already ran
+ */
+static void heap_remove(lv_timer_t * timer)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    uint32_t idx = timer->heap_idx;
+
+    if(idx < heap_cnt) {
+        /*Fill the gap with the last timer of the heap and restore the order*/
+        heap_cnt--;
+        if(idx < heap_cnt) {
+            lv_timer_t * moved = heap[heap_cnt];
+            heap_set(idx, moved);
+            heap_sift_up(idx);
+            heap_sift_down(moved->heap_idx);
+        }
+
+        /*The last place of the heap is free now, move the last timer which already ran there*/
+        if(heap_ran_cnt > 0) heap_set(heap_cnt, heap[heap_cnt + heap_ran_cnt]);
+    }
+    else {
+        heap_ran_cnt--;
+        heap_set(idx, heap[heap_cnt + heap_ran_cnt]);
+    }
+}
+
+/**
+ * Restore the order of the heap after the deadline of a timer has changed
+ * @param timer pointer to a timer
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    /*The paused timers are not in the heap and the timers which already ran are added again at the end of the handler*/
+    if(timer->paused || timer->heap_idx >= heap_cnt) return;
+
+    heap_sift_up(timer->heap_idx);
+    heap_sift_down(timer->heap_idx);
+}
+
+static void heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    LV_GC_ROOT(_lv_timer_heap)[idx] = timer;
+    timer->heap_idx = idx;
+}
+
+static void heap_sift_up(uint32_t idx)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!heap_is_before(timer, heap[parent])) break;
+        heap_set(idx, heap[parent]);
+        idx = parent;
+    }
+    heap_set(idx, timer);
+}
+
+static void heap_sift_down(uint32_t idx)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= heap_cnt) break;
+        if(child + 1 < heap_cnt && heap_is_before(heap[child + 1], heap[child])) child++;
+        if(!heap_is_before(heap[child], timer)) break;
+        heap_set(idx, heap[child]);
+        idx = child;
+    }
+    heap_set(idx, timer);
+}
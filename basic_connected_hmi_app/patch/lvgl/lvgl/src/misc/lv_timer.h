@@ -49,6 +49,7 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused :1;
+    uint32_t heap_idx :31; /**< Position in the schedule of the not paused timers*/
 } lv_timer_t;
 
 /**********************
@@ -7,6 +7,9 @@
 
 #include "lvgl_support.h"
 #include "lvgl.h"
+#if LV_USE_GPU_NXP_PXP
+#include "src/gpu/lv_gpu_nxp_pxp.h"
+#endif
 #if defined(SDK_OS_FREE_RTOS)
 #include "FreeRTOS.h"
 #include "semphr.h"
@@ -32,6 +35,18 @@
 /* Macros for the touch touch controller. */
 #define TOUCH_I2C LPI2C1
 
+/* The touch read timer is paused while the panel is not touched and resumed by the touch interrupt. */
+#if (DEMO_PANEL == DEMO_PANEL_RK043FN66HS) && defined(SDK_OS_FREE_RTOS)
+#define DEMO_TOUCH_WAKEUP 1
+#else
+#define DEMO_TOUCH_WAKEUP 0
+#endif
+
+#ifndef DEMO_TOUCH_INT_IRQn
+#define DEMO_TOUCH_INT_IRQn       GPIO1_Combined_0_15_IRQn
+#define DEMO_TOUCH_INT_IRQHandler GPIO1_Combined_0_15_IRQHandler
+#endif
+
 /* Select USB1 PLL (480 MHz) as master lpi2c clock source */
 #define TOUCH_LPI2C_CLOCK_SOURCE_SELECT (0U)
 /* Clock divider for master lpi2c clock source */
@@ -61,10 +76,22 @@
 
 #endif
 
+/* The LCDIF pixel clock is set for 60Hz, see DEMO_InitLcdClock. */
+#define DEMO_FRAME_PERIOD_MS (1000U / 60U)
+
 #define LCD_POL_FLAGS \
     (kELCDIF_DataEnableActiveHigh | kELCDIF_VsyncActiveLow | kELCDIF_HsyncActiveLow | kELCDIF_DriveDataOnRisingClkEdge)
 #define LCD_LCDIF_DATA_BUS kELCDIF_DataBus16Bit
 
+/* PXP calibration: squares of these sides are drawn by the CPU and by the PXP, the best of a few runs is kept. */
+#define DEMO_CALIB_SIDES {16, 24, 32, 48, 64, 96, 128, 192, 256}
+#define DEMO_CALIB_RUNS  3U
+
+/* Source of the flash blits, the start of the XIP image is read as pixels. */
+#ifndef DEMO_CALIB_FLASH_SRC
+#define DEMO_CALIB_FLASH_SRC ((const lv_color_t *)FlexSPI_AMBA_BASE)
+#endif
+
 /* Back light. */
 #define LCD_BL_GPIO     GPIO2
 #define LCD_BL_GPIO_PIN 31
@@ -106,10 +133,24 @@ static void DEMO_InitLcdClock(void);
 
 static void DEMO_InitLcdBackLight(void);
 
+static void DEMO_RefreshDisplay(lv_timer_t *timer);
+
 static void DEMO_FlushDisplay(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p);
 
+static void DEMO_CleanFrameBufferArea(lv_color_t *frameBuffer, const lv_area_t *area);
+
+static void DEMO_MonitorDisplay(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px);
+
+#if DEMO_FLUSH_ASYNC && defined(SDK_OS_FREE_RTOS)
+static void DEMO_WaitFlush(lv_disp_drv_t *disp_drv);
+#endif
+
 #if LV_USE_GPU_NXP_PXP
 static void DEMO_CleanInvalidateCache(lv_disp_drv_t *disp_drv);
+
+static uint32_t DEMO_CalibrateOp(lv_gpu_nxp_pxp_op_t op, const lv_color_t *src);
+
+static uint32_t DEMO_MeasureOp(lv_gpu_nxp_pxp_op_t op, const lv_color_t *src, lv_coord_t side);
 #endif
 
 static void DEMO_InitTouch(void);
@@ -125,9 +166,35 @@ static void BOARD_ConfigTouchIntPin(gt911_int_pin_mode_t mode);
  * Variables
  ******************************************************************************/
 static volatile bool s_framePending;
+/* Frame done interrupts since the LCDIF was started, and the one the frame being rendered should be shown at. */
+static volatile uint32_t s_vsyncCount;
+static uint32_t s_frameTargetVsync;
 #if defined(SDK_OS_FREE_RTOS)
 static SemaphoreHandle_t s_frameSema;
 #endif
+#if DEMO_FLUSH_ASYNC
+static lv_disp_drv_t *volatile s_flushDrv;
+#endif
+static lv_port_frame_stats_t s_frameStats;
+
+/* Areas redrawn in the current and in the previous frame, their cache lines are cleaned before scan-out. */
+static lv_area_t s_frameAreas[2][LV_INV_BUF_SIZE];
+static uint16_t s_frameAreaCount[2];
+static uint8_t s_frameAreaCur;
+static uint32_t s_frameCacheBytes;
+#if LV_USE_GPU_NXP_PXP
+static uint32_t s_pxpCacheBytes;
+static uint32_t s_pxpJobs;
+static uint32_t s_pxpSyncs;
+#endif
+static lv_layout_stats_t s_layoutStats;
+static lv_port_wakeup_cb_t s_wakeupCb;
+static lv_port_gpu_calib_t s_gpuCalib;
+
+#if DEMO_TOUCH_WAKEUP
+static lv_timer_t *s_touchTimer;
+static volatile bool s_touchIdle;
+#endif
 
 #if (DEMO_PANEL == DEMO_PANEL_RK043FN66HS)
 static gt911_handle_t s_touchHandle;
@@ -184,6 +251,14 @@ void lv_port_disp_init(void)
     /*Used to copy the buffer's content to the display*/
     disp_drv.flush_cb = DEMO_FlushDisplay;
 
+    /*Count the frames rendered within one scan-out period*/
+    disp_drv.monitor_cb = DEMO_MonitorDisplay;
+
+#if DEMO_FLUSH_ASYNC && defined(SDK_OS_FREE_RTOS)
+    /*Block instead of spinning while the draw buffer is still scanned out*/
+    disp_drv.wait_cb = DEMO_WaitFlush;
+#endif
+
 #if LV_USE_GPU_NXP_PXP
     disp_drv.clean_dcache_cb = DEMO_CleanInvalidateCache;
 #endif
@@ -191,11 +266,15 @@ void lv_port_disp_init(void)
     /*Set a display buffer*/
     disp_drv.draw_buf = &disp_buf;
 
-    /* Partial refresh */
-    disp_drv.full_refresh = 1;
+    /* Partial refresh: only the invalidated areas are redrawn into the screen sized buffers,
+     * the areas changed in the previous frame are copied forward from the displayed buffer. */
+    disp_drv.direct_mode = 1;
 
     /*Finally register the driver*/
-    lv_disp_drv_register(&disp_drv);
+    lv_disp_t *disp = lv_disp_drv_register(&disp_drv);
+
+    /*Note the frame done the refresh aims for before rendering*/
+    disp->refr_timer->timer_cb = DEMO_RefreshDisplay;
 }
 
 void LCDIF_IRQHandler(void)
@@ -208,12 +287,22 @@ void LCDIF_IRQHandler(void)
 
     ELCDIF_ClearInterruptStatus(LCDIF, intStatus);
 
+    if (intStatus & kELCDIF_CurFrameDone)
+    {
+        s_vsyncCount++;
+    }
+
     if (s_framePending)
     {
         if (intStatus & kELCDIF_CurFrameDone)
         {
             s_framePending = false;
 
+#if DEMO_FLUSH_ASYNC
+            /* The new frame is shown, the previous buffer can be drawn again. */
+            lv_disp_flush_ready(s_flushDrv);
+#endif
+
 #if defined(SDK_OS_FREE_RTOS)
             xSemaphoreGiveFromISR(s_frameSema, &taskAwake);
 
@@ -327,15 +416,85 @@ static void DEMO_CleanInvalidateCache(lv_disp_drv_t *disp_drv)
 }
 #endif
 
+static void DEMO_CleanFrameBufferArea(lv_color_t *frameBuffer, const lv_area_t *area)
+{
+    uint32_t rowSize = lv_area_get_width(area) * LCD_FB_BYTE_PER_PIXEL;
+    uint32_t addr    = (uint32_t)(frameBuffer + (area->y1 * LCD_WIDTH) + area->x1);
+    lv_coord_t y;
+
+    if (rowSize == (LCD_WIDTH * LCD_FB_BYTE_PER_PIXEL))
+    {
+        /* Full rows are contiguous. */
+        DCACHE_CleanByRange(addr, rowSize * lv_area_get_height(area));
+        s_frameCacheBytes += rowSize * lv_area_get_height(area);
+        return;
+    }
+
+    for (y = area->y1; y <= area->y2; y++)
+    {
+        DCACHE_CleanByRange(addr, rowSize);
+        addr += LCD_WIDTH * LCD_FB_BYTE_PER_PIXEL;
+    }
+    s_frameCacheBytes += rowSize * lv_area_get_height(area);
+}
+
+static void DEMO_RefreshDisplay(lv_timer_t *timer)
+{
+    /* A frame started now can be shown at the next frame done, or at the one after if the
+     * previous frame is still waiting for the next frame done to be shown. */
+    uint32_t primask   = DisableGlobalIRQ();
+    s_frameTargetVsync = s_vsyncCount + (s_framePending ? 2U : 1U);
+    EnableGlobalIRQ(primask);
+
+    _lv_disp_refr_timer(timer);
+}
+
 static void DEMO_FlushDisplay(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv_color_t *color_p)
 {
-    DCACHE_CleanInvalidateByRange((uint32_t)color_p, DEMO_FB_SIZE);
+    uint8_t prev = s_frameAreaCur ^ 1U;
+    uint16_t i;
+
+    /* Only the redrawn area has to be written back for the LCDIF. */
+    DEMO_CleanFrameBufferArea(color_p, area);
+
+    if (s_frameAreaCount[s_frameAreaCur] < LV_INV_BUF_SIZE)
+    {
+        s_frameAreas[s_frameAreaCur][s_frameAreaCount[s_frameAreaCur]++] = *area;
+    }
+
+    /* In direct mode the flush is called for every redrawn area of the frame buffer,
+     * the frame buffer is switched only once the last area is ready. */
+    if (!lv_disp_flush_is_last(disp_drv))
+    {
+        lv_disp_flush_ready(disp_drv);
+        return;
+    }
+
+    /* The areas of the previous frame were copied forward into this buffer before rendering. */
+    for (i = 0; i < s_frameAreaCount[prev]; i++)
+    {
+        DEMO_CleanFrameBufferArea(color_p, &s_frameAreas[prev][i]);
+    }
+    s_frameAreaCount[prev] = 0;
+    s_frameAreaCur         = prev;
+
+    /* The target frame done already happened: the LCDIF scanned out the previous frame again. */
+    if ((int32_t)(s_vsyncCount - s_frameTargetVsync) >= 0)
+    {
+        s_frameStats.missed++;
+    }
+
+#if DEMO_FLUSH_ASYNC
+    s_flushDrv = disp_drv;
+#endif
 
     ELCDIF_SetNextBufferAddr(LCDIF, (uint32_t)color_p);
 
     s_framePending = true;
 
-#if defined(SDK_OS_FREE_RTOS)
+#if DEMO_FLUSH_ASYNC
+    /* lv_disp_flush_ready() is called by LCDIF_IRQHandler once the frame is shown. */
+#elif defined(SDK_OS_FREE_RTOS)
     if (xSemaphoreTake(s_frameSema, portMAX_DELAY) == pdTRUE)
     {
         /* IMPORTANT!!!
@@ -358,6 +517,195 @@ static void DEMO_FlushDisplay(lv_disp_drv_t *disp_drv, const lv_area_t *area, lv
 #endif
 }
 
+static void DEMO_MonitorDisplay(lv_disp_drv_t *disp_drv, uint32_t time, uint32_t px)
+{
+#if LV_USE_GPU_NXP_PXP
+    uint32_t pxpCacheBytes = lv_gpu_nxp_pxp_get_cache_maint_bytes();
+    uint32_t pxpJobs       = lv_gpu_nxp_pxp_get_job_count();
+    uint32_t pxpSyncs      = lv_gpu_nxp_pxp_get_sync_count();
+
+    s_frameCacheBytes += pxpCacheBytes - s_pxpCacheBytes;
+    s_pxpCacheBytes       = pxpCacheBytes;
+    s_frameStats.gpuJobs  = pxpJobs - s_pxpJobs;
+    s_frameStats.gpuSyncs = pxpSyncs - s_pxpSyncs;
+    s_pxpJobs             = pxpJobs;
+    s_pxpSyncs            = pxpSyncs;
+#endif
+    s_frameStats.cacheBytes = s_frameCacheBytes;
+    s_frameCacheBytes       = 0;
+
+    lv_layout_stats_t layoutStats;
+    lv_layout_get_stats(&layoutStats);
+    s_frameStats.layoutPasses = layoutStats.passes - s_layoutStats.passes;
+    s_frameStats.layoutObjs   = layoutStats.objs - s_layoutStats.objs;
+    s_frameStats.layoutRuns   = layoutStats.runs - s_layoutStats.runs;
+    s_layoutStats             = layoutStats;
+
+    /* A frame rendered in more than one scan-out period misses the next frame done. */
+    if (time > DEMO_FRAME_PERIOD_MS)
+    {
+        s_frameStats.late++;
+    }
+    else
+    {
+        s_frameStats.onTime++;
+    }
+}
+
+#if DEMO_FLUSH_ASYNC && defined(SDK_OS_FREE_RTOS)
+static void DEMO_WaitFlush(lv_disp_drv_t *disp_drv)
+{
+    /* Woken up by LCDIF_IRQHandler, lvgl checks again if the flush is ready. */
+    (void)xSemaphoreTake(s_frameSema, portMAX_DELAY);
+}
+#endif
+
+void lv_port_get_frame_stats(lv_port_frame_stats_t *stats)
+{
+    *stats = s_frameStats;
+}
+
+/*
+ * Measure the CPU and PXP cost of fills and blits on the target and set the PXP size limits
+ * to the crossover points. Must be called from the task running lv_timer_handler().
+ *
+ * The squares are drawn into the draw buffer with a cold D-cache while the LCDIF scans out the
+ * other buffer, so cache misses and SDRAM contention are part of the result. Blits are measured
+ * from SDRAM and from FlexSPI flash and the larger crossover is kept. The screen is redrawn after.
+ */
+void lv_port_gpu_calibrate(void)
+{
+#if LV_USE_GPU_NXP_PXP
+    lv_disp_t *disp              = lv_disp_get_default();
+    lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(disp);
+    lv_area_t savedArea          = draw_buf->area;
+    const lv_color_t *sdramSrc;
+    uint32_t start;
+
+    /* The draw buffer may still be scanned out until the frame done interrupt. */
+    while (draw_buf->flushing)
+    {
+        if (disp->driver->wait_cb)
+        {
+            disp->driver->wait_cb(disp->driver);
+        }
+    }
+
+    sdramSrc = (draw_buf->buf_act == draw_buf->buf1) ? draw_buf->buf2 : draw_buf->buf1;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    start = DWT->CYCCNT;
+
+    draw_buf->area.x1 = 0;
+    draw_buf->area.y1 = 0;
+    draw_buf->area.x2 = LCD_WIDTH - 1;
+    draw_buf->area.y2 = LCD_HEIGHT - 1;
+    _lv_refr_set_disp_refreshing(disp);
+
+    s_gpuCalib.fill         = DEMO_CalibrateOp(LV_GPU_NXP_PXP_OP_FILL, NULL);
+    s_gpuCalib.fillOpa      = DEMO_CalibrateOp(LV_GPU_NXP_PXP_OP_FILL_OPA, NULL);
+    s_gpuCalib.blitSdram    = DEMO_CalibrateOp(LV_GPU_NXP_PXP_OP_BLIT, sdramSrc);
+    s_gpuCalib.blitFlash    = DEMO_CalibrateOp(LV_GPU_NXP_PXP_OP_BLIT, DEMO_CALIB_FLASH_SRC);
+    s_gpuCalib.blitOpaSdram = DEMO_CalibrateOp(LV_GPU_NXP_PXP_OP_BLIT_OPA, sdramSrc);
+    s_gpuCalib.blitOpaFlash = DEMO_CalibrateOp(LV_GPU_NXP_PXP_OP_BLIT_OPA, DEMO_CALIB_FLASH_SRC);
+    s_gpuCalib.blit         = LV_MAX(s_gpuCalib.blitSdram, s_gpuCalib.blitFlash);
+    s_gpuCalib.blitOpa      = LV_MAX(s_gpuCalib.blitOpaSdram, s_gpuCalib.blitOpaFlash);
+
+    _lv_refr_set_disp_refreshing(NULL);
+    draw_buf->area = savedArea;
+
+    lv_gpu_nxp_pxp_set_size_limit(LV_GPU_NXP_PXP_OP_FILL, s_gpuCalib.fill);
+    lv_gpu_nxp_pxp_set_size_limit(LV_GPU_NXP_PXP_OP_FILL_OPA, s_gpuCalib.fillOpa);
+    lv_gpu_nxp_pxp_set_size_limit(LV_GPU_NXP_PXP_OP_BLIT, s_gpuCalib.blit);
+    lv_gpu_nxp_pxp_set_size_limit(LV_GPU_NXP_PXP_OP_BLIT_OPA, s_gpuCalib.blitOpa);
+
+    s_gpuCalib.durationMs = (DWT->CYCCNT - start) / (SystemCoreClock / 1000U);
+    s_gpuCalib.calibrated = true;
+
+    /* The draw buffer content is lost, in direct mode the redraw is copied forward to the other buffer. */
+    lv_obj_invalidate(lv_disp_get_scr_act(disp));
+#endif
+}
+
+void lv_port_get_gpu_calib(lv_port_gpu_calib_t *calib)
+{
+#if LV_USE_GPU_NXP_PXP
+    if (!s_gpuCalib.calibrated)
+    {
+        s_gpuCalib.fill    = lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_FILL);
+        s_gpuCalib.fillOpa = lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_FILL_OPA);
+        s_gpuCalib.blit    = lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_BLIT);
+        s_gpuCalib.blitOpa = lv_gpu_nxp_pxp_get_size_limit(LV_GPU_NXP_PXP_OP_BLIT_OPA);
+    }
+#endif
+    *calib = s_gpuCalib;
+}
+
+#if LV_USE_GPU_NXP_PXP
+/* Smallest measured area from which the PXP is not slower than the CPU at any larger size. */
+static uint32_t DEMO_CalibrateOp(lv_gpu_nxp_pxp_op_t op, const lv_color_t *src)
+{
+    static const lv_coord_t sides[] = DEMO_CALIB_SIDES;
+    uint32_t crossover              = UINT32_MAX;
+    uint32_t cpuCycles;
+    uint32_t pxpCycles;
+    int32_t i;
+
+    for (i = (int32_t)(sizeof(sides) / sizeof(sides[0])) - 1; i >= 0; i--)
+    {
+        lv_gpu_nxp_pxp_set_size_limit(op, UINT32_MAX);
+        cpuCycles = DEMO_MeasureOp(op, src, sides[i]);
+        lv_gpu_nxp_pxp_set_size_limit(op, 0U);
+        pxpCycles = DEMO_MeasureOp(op, src, sides[i]);
+
+        if (pxpCycles > cpuCycles)
+        {
+            break;
+        }
+        crossover = (uint32_t)sides[i] * sides[i];
+    }
+
+    return crossover;
+}
+
+/* Cycles of the fastest run of one fill or blit of a square, the PXP job is waited for. */
+static uint32_t DEMO_MeasureOp(lv_gpu_nxp_pxp_op_t op, const lv_color_t *src, lv_coord_t side)
+{
+    lv_disp_draw_buf_t *draw_buf = lv_disp_get_draw_buf(lv_disp_get_default());
+    lv_area_t area               = {.x1 = 0, .y1 = 0, .x2 = side - 1, .y2 = side - 1};
+    lv_opa_t opa = ((op == LV_GPU_NXP_PXP_OP_FILL) || (op == LV_GPU_NXP_PXP_OP_BLIT)) ? LV_OPA_COVER : LV_OPA_50;
+    uint32_t best                = UINT32_MAX;
+    uint32_t start;
+    uint32_t run;
+
+    for (run = 0; run < DEMO_CALIB_RUNS; run++)
+    {
+        DCACHE_CleanInvalidateByRange((uint32_t)draw_buf->buf_act, side * LCD_WIDTH * LCD_FB_BYTE_PER_PIXEL);
+        if (src != NULL)
+        {
+            DCACHE_CleanInvalidateByRange((uint32_t)src, side * side * LCD_FB_BYTE_PER_PIXEL);
+        }
+
+        start = DWT->CYCCNT;
+        if (src == NULL)
+        {
+            _lv_blend_fill(&area, &area, lv_color_make(0x20, 0x40, 0x80), NULL, LV_DRAW_MASK_RES_FULL_COVER, opa,
+                           LV_BLEND_MODE_NORMAL);
+        }
+        else
+        {
+            _lv_blend_map(&area, &area, src, NULL, LV_DRAW_MASK_RES_FULL_COVER, opa, LV_BLEND_MODE_NORMAL);
+        }
+        lv_gpu_nxp_pxp_wait();
+
+        best = LV_MIN(best, DWT->CYCCNT - start);
+    }
+
+    return best;
+}
+#endif
+
 void lv_port_indev_init(void)
 {
     static lv_indev_drv_t indev_drv;
@@ -374,7 +722,53 @@ void lv_port_indev_init(void)
     indev_drv.type    = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = DEMO_ReadTouch;
     lv_indev_drv_register(&indev_drv);
+
+#if DEMO_TOUCH_WAKEUP
+    s_touchTimer = indev_drv.read_timer;
+
+    GPIO_PinSetInterruptConfig(BOARD_TOUCH_INT_GPIO, BOARD_TOUCH_INT_PIN, kGPIO_IntRisingEdge);
+    GPIO_PortClearInterruptFlags(BOARD_TOUCH_INT_GPIO, 1UL << BOARD_TOUCH_INT_PIN);
+    GPIO_PortEnableInterrupts(BOARD_TOUCH_INT_GPIO, 1UL << BOARD_TOUCH_INT_PIN);
+    NVIC_SetPriority(DEMO_TOUCH_INT_IRQn, configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1);
+    EnableIRQ(DEMO_TOUCH_INT_IRQn);
+#endif
+}
+
+void lv_port_set_wakeup_cb(lv_port_wakeup_cb_t wakeupCb)
+{
+    s_wakeupCb = wakeupCb;
+}
+
+/* Must be called from the task running lv_timer_handler(), after the wakeup callback was called. */
+void lv_port_process_wakeup(void)
+{
+#if DEMO_TOUCH_WAKEUP
+    if ((s_touchTimer != NULL) && s_touchTimer->paused && !s_touchIdle)
+    {
+        lv_timer_resume(s_touchTimer);
+        lv_timer_ready(s_touchTimer);
+    }
+#endif
+}
+
+#if DEMO_TOUCH_WAKEUP
+void DEMO_TOUCH_INT_IRQHandler(void)
+{
+    GPIO_PortClearInterruptFlags(BOARD_TOUCH_INT_GPIO, 1UL << BOARD_TOUCH_INT_PIN);
+
+    /* The GT911 pulses the interrupt at every report while touched, only the first one wakes up. */
+    if (s_touchIdle)
+    {
+        s_touchIdle = false;
+
+        if (s_wakeupCb != NULL)
+        {
+            s_wakeupCb();
+        }
+    }
+    SDK_ISR_EXIT_BARRIER;
 }
+#endif
 
 #if (DEMO_PANEL == DEMO_PANEL_RK043FN66HS)
 static void BOARD_PullTouchResetPin(bool pullUp)
@@ -450,6 +844,15 @@ static void DEMO_ReadTouch(lv_indev_drv_t *drv, lv_indev_data_t *data)
     else
     {
         data->state = LV_INDEV_STATE_REL;
+
+#if DEMO_TOUCH_WAKEUP
+        /* Nothing to poll until the next touch, unless a scroll is still being thrown. */
+        if ((s_wakeupCb != NULL) && (lv_indev_get_act()->proc.types.pointer.scroll_obj == NULL))
+        {
+            s_touchIdle = true;
+            lv_timer_pause(drv->read_timer);
+        }
+#endif
     }
 
     /*Set the last pressed coordinates*/
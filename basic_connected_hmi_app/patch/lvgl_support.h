@@ -9,6 +9,7 @@
 #define LVGL_SUPPORT_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 /*******************************************************************************
  * Definitions
@@ -26,6 +27,49 @@
 #define LCD_HEIGHT            272
 #define LCD_FB_BYTE_PER_PIXEL 2
 
+/* 1: The flush returns at once and lv_disp_flush_ready() is called from the LCDIF frame done interrupt.
+ * 0: The flush waits for the frame done interrupt. */
+#ifndef DEMO_FLUSH_ASYNC
+#define DEMO_FLUSH_ASYNC 1
+#endif
+
+/*******************************************************************************
+ * Types
+ ******************************************************************************/
+
+/* Frame pacing counters of the LCDIF flush. */
+typedef struct
+{
+    uint32_t onTime;     /* Frames rendered within one scan-out period. */
+    uint32_t late;       /* Frames that took longer and missed a frame done. */
+    uint32_t missed;     /* Frames flushed after the frame done they were rendered for. */
+    uint32_t cacheBytes; /* D-cache bytes cleaned or invalidated for the last frame. */
+    uint32_t gpuJobs;    /* PXP fills and blits queued for the last frame. */
+    uint32_t gpuSyncs;   /* Times the last frame waited for a pending PXP job. */
+    uint32_t layoutPasses; /* Layout updates of a screen since the previous frame. */
+    uint32_t layoutObjs;   /* Objects resized or moved by these layout updates. */
+    uint32_t layoutRuns;   /* Flex and grid containers arranged by these layout updates. */
+} lv_port_frame_stats_t;
+
+/* CPU/PXP crossover points measured by lv_port_gpu_calibrate(), in pixels.
+ * UINT32_MAX means the CPU was faster at every measured size. */
+typedef struct
+{
+    bool calibrated;       /* False until a calibration ran, the limits are the compile-time defaults. */
+    uint32_t fill;         /* Fill with 100% opacity. */
+    uint32_t fillOpa;      /* Fill with transparency. */
+    uint32_t blit;         /* Image copy with 100% opacity, the larger of the two source crossovers. */
+    uint32_t blitOpa;      /* Image copy with transparency, the larger of the two source crossovers. */
+    uint32_t blitSdram;    /* Image copy with 100% opacity from SDRAM. */
+    uint32_t blitFlash;    /* Image copy with 100% opacity from FlexSPI flash. */
+    uint32_t blitOpaSdram; /* Image copy with transparency from SDRAM. */
+    uint32_t blitOpaFlash; /* Image copy with transparency from FlexSPI flash. */
+    uint32_t durationMs;   /* Time spent in the last calibration. */
+} lv_port_gpu_calib_t;
+
+/* Called from interrupt context when the task running lv_timer_handler() has to be woken up. */
+typedef void (*lv_port_wakeup_cb_t)(void);
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -37,6 +81,11 @@ extern "C" {
 void lv_port_pre_init(void);
 void lv_port_disp_init(void);
 void lv_port_indev_init(void);
+void lv_port_get_frame_stats(lv_port_frame_stats_t *stats);
+void lv_port_gpu_calibrate(void);
+void lv_port_get_gpu_calib(lv_port_gpu_calib_t *calib);
+void lv_port_set_wakeup_cb(lv_port_wakeup_cb_t wakeupCb);
+void lv_port_process_wakeup(void);
 
 #if defined(__cplusplus)
 }
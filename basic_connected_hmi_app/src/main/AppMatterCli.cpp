@@ -32,6 +32,12 @@
 #include "WifiConnect.h"
 #endif
 
+#if (defined(CHIP_DEVICE_CONFIG_ENABLE_DISPLAY) && (CHIP_DEVICE_CONFIG_ENABLE_DISPLAY > 0U))
+#include "lvgl.h"
+#include "lvgl_support.h"
+#include "display_app.h"
+#endif
+
 #define MATTER_CLI_TASK_SIZE ((configSTACK_DEPTH_TYPE)2048 / sizeof(portSTACK_TYPE))
 #define MATTER_CLI_LOG(message) (streamer_printf(streamer_get(), message))
 
@@ -106,6 +112,181 @@ CHIP_ERROR cliLogs(int argc, char * argv[])
     return CHIP_NO_ERROR;
 }
 
+#if (defined(CHIP_DEVICE_CONFIG_ENABLE_DISPLAY) && (CHIP_DEVICE_CONFIG_ENABLE_DISPLAY > 0U))
+CHIP_ERROR cliDisplayStats(int argc, char * argv[])
+{
+    char text[128];
+    lv_port_frame_stats_t frameStats;
+    DisplayQueueStats_t queueStats;
+    DisplayFieldStats_t fieldStats;
+    lv_img_cache_stats_t imgCacheStats;
+    lv_draw_shadow_cache_stats_t shadowCacheStats;
+    lv_draw_glyph_cache_stats_t glyphCacheStats;
+    lv_mem_buf_arena_stats_t bufArenaStats;
+    DisplayMemStats_t memStats;
+    lv_obj_style_stats_t styleStats;
+    lv_layout_stats_t layoutStats;
+
+    lv_port_get_frame_stats(&frameStats);
+
+    snprintf(text, sizeof(text), "Frames: on-time %lu, late %lu, missed vsync %lu\r\n", (unsigned long) frameStats.onTime,
+             (unsigned long) frameStats.late, (unsigned long) frameStats.missed);
+    MATTER_CLI_LOG(text);
+
+    snprintf(text, sizeof(text), "D-cache maintenance: %lu bytes in the last frame\r\n", (unsigned long) frameStats.cacheBytes);
+    MATTER_CLI_LOG(text);
+
+    snprintf(text, sizeof(text), "PXP: %lu jobs, %lu CPU waits in the last frame\r\n", (unsigned long) frameStats.gpuJobs,
+             (unsigned long) frameStats.gpuSyncs);
+    MATTER_CLI_LOG(text);
+
+    snprintf(text, sizeof(text), "Layout: %lu passes, %lu objects, %lu flex/grid runs in the last frame\r\n",
+             (unsigned long) frameStats.layoutPasses, (unsigned long) frameStats.layoutObjs, (unsigned long) frameStats.layoutRuns);
+    MATTER_CLI_LOG(text);
+
+    snprintf(text, sizeof(text), "Display task wake-ups: %lu/s\r\n", (unsigned long) getDisplayWakeupsPerSecond());
+    MATTER_CLI_LOG(text);
+
+    snprintf(text, sizeof(text), "Animation refreshes: %lu/s\r\n", (unsigned long) getAnimRefreshesPerSecond());
+    MATTER_CLI_LOG(text);
+
+    getDisplayQueueStats(&queueStats);
+    snprintf(text, sizeof(text), "UI updates: posted %lu, coalesced %lu, rejected %lu, latency max %lu ms, avg %lu ms\r\n",
+             (unsigned long) queueStats.posted, (unsigned long) queueStats.coalesced, (unsigned long) queueStats.rejected,
+             (unsigned long) queueStats.maxLatencyMs, (unsigned long) queueStats.avgLatencyMs);
+    MATTER_CLI_LOG(text);
+
+    snprintf(text, sizeof(text), "UI logs: dropped %lu, truncated %lu\r\n", (unsigned long) queueStats.overflows,
+             (unsigned long) queueStats.truncated);
+    MATTER_CLI_LOG(text);
+
+    for (int field = 0; field < kDisplayField_Count; field++)
+    {
+        const char * name = getDisplayFieldStats((DisplayField_t) field, &fieldStats);
+        snprintf(text, sizeof(text), "UI field %s: applied %lu, skipped %lu\r\n", name, (unsigned long) fieldStats.applied,
+                 (unsigned long) fieldStats.skipped);
+        MATTER_CLI_LOG(text);
+    }
+
+    lv_img_cache_get_stats(&imgCacheStats);
+    snprintf(text, sizeof(text), "Image cache: %u/%u entries, %lu/%lu bytes, hits %lu, misses %lu, evictions %lu\r\n",
+             (unsigned) imgCacheStats.entries, (unsigned) imgCacheStats.max_entries, (unsigned long) imgCacheStats.size,
+             (unsigned long) imgCacheStats.budget, (unsigned long) imgCacheStats.hits, (unsigned long) imgCacheStats.misses,
+             (unsigned long) imgCacheStats.evictions);
+    MATTER_CLI_LOG(text);
+
+    lv_draw_shadow_cache_get_stats(&shadowCacheStats);
+    snprintf(text, sizeof(text), "Shadow cache: %u corners, %lu/%lu bytes, hits %lu, misses %lu, evictions %lu\r\n",
+             (unsigned) shadowCacheStats.entries, (unsigned long) shadowCacheStats.size, (unsigned long) shadowCacheStats.budget,
+             (unsigned long) shadowCacheStats.hits, (unsigned long) shadowCacheStats.misses,
+             (unsigned long) shadowCacheStats.evictions);
+    MATTER_CLI_LOG(text);
+
+    lv_draw_glyph_cache_get_stats(&glyphCacheStats);
+    snprintf(text, sizeof(text), "Glyph cache: %u glyphs, %lu/%lu bytes, hits %lu, misses %lu, evictions %lu\r\n",
+             (unsigned) glyphCacheStats.entries, (unsigned long) glyphCacheStats.size, (unsigned long) glyphCacheStats.budget,
+             (unsigned long) glyphCacheStats.hits, (unsigned long) glyphCacheStats.misses,
+             (unsigned long) glyphCacheStats.evictions);
+    MATTER_CLI_LOG(text);
+
+    lv_layout_get_stats(&layoutStats);
+    snprintf(text, sizeof(text), "Layout since start-up: %lu passes, %lu objects, %lu children skipped on a parent resize\r\n",
+             (unsigned long) layoutStats.passes, (unsigned long) layoutStats.objs, (unsigned long) layoutStats.skipped);
+    MATTER_CLI_LOG(text);
+
+    lv_obj_style_get_stats(&styleStats);
+    snprintf(text, sizeof(text), "Style lookups: %lu, list walks %lu, cache hits %lu\r\n", (unsigned long) styleStats.lookups,
+             (unsigned long) styleStats.walks, (unsigned long) styleStats.hits);
+    MATTER_CLI_LOG(text);
+
+    lv_mem_buf_arena_get_stats(&bufArenaStats);
+    snprintf(text, sizeof(text), "Draw buffer arena: %lu/%lu bytes, high-water %lu, heap fallbacks %lu\r\n",
+             (unsigned long) bufArenaStats.used, (unsigned long) bufArenaStats.size, (unsigned long) bufArenaStats.max_used,
+             (unsigned long) bufArenaStats.overflow_cnt);
+    MATTER_CLI_LOG(text);
+
+    /* The LVGL heap is walked by the display task only, wait for it to take a snapshot */
+    getMemStats(&memStats);
+    uint32_t lastSequence = memStats.sequence;
+    requestMemStats();
+    for (int i = 0; (i < 20) && (memStats.sequence == lastSequence); i++)
+    {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        getMemStats(&memStats);
+    }
+
+    if (memStats.sequence == 0)
+    {
+        MATTER_CLI_LOG("LVGL heap: no snapshot from the display task yet\r\n");
+        return CHIP_NO_ERROR;
+    }
+
+    snprintf(text, sizeof(text), "LVGL heap%s: %lu/%lu bytes, %u%% frag.; slabs: %lu/%lu bytes, %u%% frag., heap fallbacks %lu\r\n",
+             (memStats.sequence == lastSequence) ? " (previous snapshot)" : "",
+             (unsigned long) (memStats.totalSize - memStats.freeSize), (unsigned long) memStats.totalSize,
+             (unsigned) memStats.fragPct, (unsigned long) memStats.slabUsed, (unsigned long) memStats.slabSize,
+             (unsigned) memStats.slabFragPct, (unsigned long) memStats.slabFallbacks);
+    MATTER_CLI_LOG(text);
+
+    for (uint8_t i = 0; i < memStats.slabClassCnt; i++)
+    {
+        const DisplaySlabClassStats_t * slabClass = &memStats.slabClasses[i];
+        if (slabClass->pageCnt == 0)
+        {
+            continue;
+        }
+        snprintf(text, sizeof(text), "  %u byte blocks: %u pages, %u used, %u free\r\n", (unsigned) slabClass->blockSize,
+                 (unsigned) slabClass->pageCnt, (unsigned) slabClass->usedCnt, (unsigned) slabClass->freeCnt);
+        MATTER_CLI_LOG(text);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR cliGpuCalib(int argc, char * argv[])
+{
+    char text[128];
+    lv_port_gpu_calib_t calib;
+
+    if ((argc == 1) && (strcmp(argv[0], "run") == 0))
+    {
+        /* The measurement draws with LVGL, the display task runs it */
+        requestGpuCalibration();
+        MATTER_CLI_LOG("PXP calibration requested, run gpucalib to show the result\r\n");
+        return CHIP_NO_ERROR;
+    }
+    else if (argc != 0)
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    lv_port_get_gpu_calib(&calib);
+
+    snprintf(text, sizeof(text), "PXP size limits (%s):\r\n",
+             calib.calibrated ? "calibrated" : "compile-time defaults");
+    MATTER_CLI_LOG(text);
+
+    snprintf(text, sizeof(text), "  fill %lu px, fill opa %lu px, blit %lu px, blit opa %lu px\r\n",
+             (unsigned long) calib.fill, (unsigned long) calib.fillOpa, (unsigned long) calib.blit,
+             (unsigned long) calib.blitOpa);
+    MATTER_CLI_LOG(text);
+
+    if (calib.calibrated)
+    {
+        snprintf(text, sizeof(text), "  blit from SDRAM %lu px, flash %lu px; blit opa from SDRAM %lu px, flash %lu px\r\n",
+                 (unsigned long) calib.blitSdram, (unsigned long) calib.blitFlash, (unsigned long) calib.blitOpaSdram,
+                 (unsigned long) calib.blitOpaFlash);
+        MATTER_CLI_LOG(text);
+
+        snprintf(text, sizeof(text), "  measured in %lu ms, a limit of %lu px keeps the operation on the CPU\r\n",
+                 (unsigned long) calib.durationMs, (unsigned long) UINT32_MAX);
+        MATTER_CLI_LOG(text);
+    }
+
+    return CHIP_NO_ERROR;
+}
+#endif /* CHIP_DEVICE_CONFIG_ENABLE_DISPLAY */
+
 #if WIFI_CONNECT
 CHIP_ERROR cliWifiScan(int argc, char * argv[])
 {
@@ -193,6 +374,18 @@ CHIP_ERROR AppMatterCli_RegisterCommands(void)
                 .cmd_name = "matterlogs",
                 .cmd_help = "Enable or disable Matter logs",
             },
+#if (defined(CHIP_DEVICE_CONFIG_ENABLE_DISPLAY) && (CHIP_DEVICE_CONFIG_ENABLE_DISPLAY > 0U))
+            {
+                .cmd_func = cliDisplayStats,
+                .cmd_name = "displaystats",
+                .cmd_help = "Show the display performance counters. Usage : displaystats",
+            },
+            {
+                .cmd_func = cliGpuCalib,
+                .cmd_name = "gpucalib",
+                .cmd_help = "Show the CPU/PXP crossover sizes, or measure them again. Usage : gpucalib [run]",
+            },
+#endif /* CHIP_DEVICE_CONFIG_ENABLE_DISPLAY */
 #if WIFI_CONNECT
             {
                 .cmd_func = cliWifiScan,
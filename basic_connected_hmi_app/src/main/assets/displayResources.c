@@ -33,11 +33,24 @@ lv_style_t gSmallTextStyle;
 lv_style_t gMediumTextStyle;
 lv_style_t gLargeTextStyle;
 lv_style_t gBigTextStyle;
+lv_style_t gTinyTextStyle;
+lv_style_t gNormalTextStyle;
+lv_style_t gIconBlueStyle;
+lv_style_t gIconRedStyle;
+lv_style_t gIconGreyStyle;
+lv_style_t gIconLightGreyStyle;
+lv_style_t gIconDarkGreyStyle;
+lv_style_t gIconDarkerGreyStyle;
+lv_style_t gIconDeepOrangeStyle;
+lv_style_t gIconOrangeStyle;
+lv_style_t gDeviceRowStyle;
+lv_style_t gDeviceRowAltStyle;
+lv_style_t gDeviceHeaderStyle;
 
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
-
+static void lv_initIconStyle(lv_style_t * style, lv_color_t color);
 
 
 /*******************************************************************************
@@ -148,4 +161,55 @@ void lv_initResources(void)
     lv_style_init(&gLargeTextStyle);
     lv_style_set_text_font(&gLargeTextStyle, &lv_font_montserrat_30);
     lv_style_set_border_width(&gLargeTextStyle, 0);
+
+    /* Tiny Text Style */
+    lv_style_init(&gTinyTextStyle);
+    lv_style_set_text_font(&gTinyTextStyle, &lv_font_montserrat_10);
+    lv_style_set_border_width(&gTinyTextStyle, 0);
+
+    /* Normal Text Style */
+    lv_style_init(&gNormalTextStyle);
+    lv_style_set_text_font(&gNormalTextStyle, &lv_font_montserrat_16);
+    lv_style_set_border_width(&gNormalTextStyle, 0);
+
+    /* Status card icon Styles */
+    lv_initIconStyle(&gIconBlueStyle, lv_palette_main(LV_PALETTE_LIGHT_BLUE));
+    lv_initIconStyle(&gIconRedStyle, lv_palette_main(LV_PALETTE_RED));
+    lv_initIconStyle(&gIconGreyStyle, lv_palette_main(LV_PALETTE_GREY));
+    lv_initIconStyle(&gIconLightGreyStyle, lv_palette_lighten(LV_PALETTE_GREY, 1));
+    lv_initIconStyle(&gIconDarkGreyStyle, lv_palette_darken(LV_PALETTE_GREY, 1));
+    lv_initIconStyle(&gIconDarkerGreyStyle, lv_palette_darken(LV_PALETTE_GREY, 2));
+    lv_initIconStyle(&gIconDeepOrangeStyle, lv_palette_main(LV_PALETTE_DEEP_ORANGE));
+    lv_initIconStyle(&gIconOrangeStyle, lv_palette_lighten(LV_PALETTE_ORANGE, 1));
+
+    /* Devices list row Style */
+    lv_style_init(&gDeviceRowStyle);
+    lv_style_set_bg_color(&gDeviceRowStyle, lv_color_white());
+    lv_style_set_bg_opa(&gDeviceRowStyle, 255);
+    lv_style_set_radius(&gDeviceRowStyle, 0);
+    lv_style_set_border_width(&gDeviceRowStyle, 1);
+    lv_style_set_border_color(&gDeviceRowStyle, lv_palette_lighten(LV_PALETTE_GREY, 2));
+    lv_style_set_border_side(&gDeviceRowStyle, LV_BORDER_SIDE_BOTTOM);
+    lv_style_set_shadow_opa(&gDeviceRowStyle, 0);
+    lv_style_set_pad_left(&gDeviceRowStyle, 10);
+    lv_style_set_pad_right(&gDeviceRowStyle, 0);
+    lv_style_set_pad_top(&gDeviceRowStyle, 0);
+    lv_style_set_pad_bottom(&gDeviceRowStyle, 0);
+
+    /* Every 2nd row of the devices list is grayish */
+    lv_style_init(&gDeviceRowAltStyle);
+    lv_style_set_bg_color(&gDeviceRowAltStyle, lv_color_mix(lv_palette_main(LV_PALETTE_GREY), lv_color_white(), LV_OPA_10));
+
+    /* Devices list header Style */
+    lv_style_init(&gDeviceHeaderStyle);
+    lv_style_set_bg_color(&gDeviceHeaderStyle, lv_color_mix(lv_palette_main(LV_PALETTE_BLUE), lv_color_white(), LV_OPA_20));
+    lv_style_set_text_align(&gDeviceHeaderStyle, LV_TEXT_ALIGN_CENTER);
+    lv_style_set_pad_left(&gDeviceHeaderStyle, 0);
+}
+
+static void lv_initIconStyle(lv_style_t * style, lv_color_t color)
+{
+    lv_style_init(style);
+    lv_style_set_img_recolor(style, color);
+    lv_style_set_img_recolor_opa(style, 255);
 }
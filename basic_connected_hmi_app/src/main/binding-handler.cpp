@@ -46,8 +46,8 @@ using namespace chip::app;
 
 namespace {
 
-static int isSubscribed[]={0,0,0,0,0,0,0,0,0,0};
-CHIP_ERROR ret[10];
+static int isSubscribed[EMBER_BINDING_TABLE_SIZE];
+CHIP_ERROR ret[EMBER_BINDING_TABLE_SIZE];
 
 static bool sSwitchOnOffState = false;
 #if defined(ENABLE_CHIP_SHELL)
@@ -81,7 +81,7 @@ static void RegisterSwitchCommands()
 }
 #endif // defined(ENABLE_CHIP_SHELL)
 
-void ProcessOnOffUnicastSubscribeLight(const EmberBindingTableEntry & binding, OperationalDeviceProxy * peer_device, uint8_t device)
+void ProcessOnOffUnicastSubscribeLight(const EmberBindingTableEntry & binding, OperationalDeviceProxy * peer_device, uint16_t device)
 {
     auto onSuccess = [device](const app::ConcreteDataAttributePath & attributePath, const auto & dataResponse) {
         ChipLogProgress(NotSpecified, "OnOff report received");
@@ -105,7 +105,7 @@ void ProcessOnOffUnicastSubscribeLight(const EmberBindingTableEntry & binding, O
     };
 
    
-    ret[device] = Controller::SubscribeAttribute<bool>(peer_device->GetExchangeManager(), peer_device->GetSecureSession().Value(), 0XFFFF, 0x0006 , 0x0000,
+    ret[device-1] = Controller::SubscribeAttribute<bool>(peer_device->GetExchangeManager(), peer_device->GetSecureSession().Value(), 0XFFFF, 0x0006 , 0x0000,
     													     onSuccess, onFailure, 0, 600, onSubscriptionEstablishedCb, onResubscriptionAttemptCb,
                                                              false, true);
 }
@@ -125,7 +125,7 @@ void ProcessOnOffUnicastBindingCommand(const EmberBindingTableEntry & binding, O
 }
 
 
-void GetDeviceInfo(const EmberBindingTableEntry & binding, DeviceProxy * peer_device, uint8_t device)
+void GetDeviceInfo(const EmberBindingTableEntry & binding, DeviceProxy * peer_device, uint16_t device)
 {
 	auto Success = [device](const app::ConcreteDataAttributePath & attributePath, const auto & dataResponse) {
         	ChipLogProgress(NotSpecified, "Getting device info");
@@ -148,7 +148,7 @@ void GetDeviceInfo(const EmberBindingTableEntry & binding, DeviceProxy * peer_de
 #endif
     	};
 	
-	ret[device] = Controller::ReadAttribute<chip::app::Clusters::GeneralDiagnostics::Attributes::NetworkInterfaces::TypeInfo::DecodableType>(peer_device->GetExchangeManager(), 
+	ret[device-1] = Controller::ReadAttribute<chip::app::Clusters::GeneralDiagnostics::Attributes::NetworkInterfaces::TypeInfo::DecodableType>(peer_device->GetExchangeManager(), 
 																		 peer_device->GetSecureSession().Value(), 
 																		 0, 0x0033, 0x0000,Success, Failure);
 }
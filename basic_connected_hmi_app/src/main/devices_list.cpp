@@ -0,0 +1,275 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "devices_list.h"
+#include "lvgl_support.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Row widgets recycled by the devices list: more than the rows which can be visible at once,
+ * and even, so a row widget always shows rows of the same parity */
+#define DEVICES_LIST_POOL_SIZE    (((LCD_HEIGHT / DEVICES_ROW_HEIGHT) + 3) & ~1)
+#define DEVICES_ROW_NONE          0xFFFFFFFF
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* A row widget of the devices list, drawing the cells `texts` of the device `index` */
+typedef struct {
+    lv_obj_t * row;
+    const char * texts[DEVICES_LIST_COLS];
+    uint32_t index;
+    char name[12];
+} DeviceRowSlot_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void devices_list_event_cb(lv_event_t * e);
+static void devices_list_layout(lv_obj_t * list, void * user_data);
+static lv_obj_t * devices_row_create(lv_obj_t * parent, const char ** texts);
+static void devices_row_event_cb(lv_event_t * e);
+static void devices_list_refresh(void);
+static void devices_list_refresh_row(uint32_t index);
+static void devices_slot_update(DeviceRowSlot_t * slot);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+extern lv_style_t gInvisibleContainerStyle;
+extern lv_style_t gDeviceRowStyle;
+extern lv_style_t gDeviceRowAltStyle;
+extern lv_style_t gDeviceHeaderStyle;
+
+/* The devices list shows `deviceRows` with a pool of row widgets,
+ * the device `i` is shown by `deviceSlots[i % DEVICES_LIST_POOL_SIZE]` */
+static lv_obj_t * devicesList;
+static uint32_t devicesListLayout;
+static DeviceRow_t * deviceRows;
+static uint32_t deviceRowCount;
+static uint32_t deviceCount;
+static DeviceRowSlot_t deviceSlots[DEVICES_LIST_POOL_SIZE];
+static const char * devicesHeaderTexts[DEVICES_LIST_COLS] = { "Device", "Network", "Status", "Cluster" };
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+void devices_list_create(lv_obj_t * parent, DeviceRow_t * rows, uint32_t rowCount)
+{
+    LV_ASSERT(rowCount * DEVICES_ROW_HEIGHT < (uint32_t) LV_COORD_MAX);
+    deviceRows = rows;
+    deviceRowCount = rowCount;
+
+    /* Header, it stays in place while the list scrolls */
+    lv_obj_t * header = devices_row_create(parent, devicesHeaderTexts);
+    lv_obj_add_style(header, &gDeviceHeaderStyle, LV_STATE_DEFAULT);
+
+    /* Devices list, it reports the height of all the devices as its content (see devices_list_event_cb) */
+    devicesList = lv_obj_create(parent);
+    lv_obj_set_width(devicesList, lv_pct(100));
+    lv_obj_set_flex_grow(devicesList, 1);
+    lv_obj_add_style(devicesList, &gInvisibleContainerStyle, LV_STATE_DEFAULT);
+    lv_obj_set_scroll_dir(devicesList, LV_DIR_VER);
+    lv_obj_add_event_cb(devicesList, devices_list_event_cb, LV_EVENT_ALL, NULL);
+    /* The rows are placed by a layout: style positions can't reach the bottom of a long list */
+    devicesListLayout = lv_layout_register(devices_list_layout, NULL);
+    lv_obj_set_layout(devicesList, devicesListLayout);
+
+    for(uint32_t i = 0; i < DEVICES_LIST_POOL_SIZE; i++)
+    {
+        deviceSlots[i].row = devices_row_create(devicesList, deviceSlots[i].texts);
+        deviceSlots[i].texts[0] = deviceSlots[i].name;
+        deviceSlots[i].index = DEVICES_ROW_NONE;
+        lv_obj_add_flag(deviceSlots[i].row, LV_OBJ_FLAG_HIDDEN);
+        if(i % 2){
+            lv_obj_add_style(deviceSlots[i].row, &gDeviceRowAltStyle, LV_STATE_DEFAULT);
+        }
+    }
+}
+
+uint32_t devices_list_set_table(uint16_t total, const uint32_t * isOnOff)
+{
+    /* The devices beyond the model aren't shown */
+    uint32_t last = LV_MIN((uint32_t) total, deviceRowCount);
+
+    for(uint32_t i = 0; i < last; i++)
+    {
+        deviceRows[i].network = "Unknown";
+        deviceRows[i].status = "Unknown";
+
+        if((isOnOff[i / 32] >> (i % 32)) & 1U){
+            deviceRows[i].cluster = "On-Off";
+        }
+        else{
+            deviceRows[i].cluster = "Unknown";
+        }
+    }
+
+    if(last != deviceCount){
+        lv_obj_scrollbar_invalidate(devicesList);
+        deviceCount = last;
+        lv_obj_scrollbar_invalidate(devicesList);
+        lv_obj_readjust_scroll(devicesList, LV_ANIM_OFF);
+    }
+
+    devices_list_refresh();
+    return last;
+}
+
+void devices_list_set_status(uint16_t device, const char * status)
+{
+    if(device >= deviceRowCount){
+        return;
+    }
+
+    deviceRows[device].status = status;
+    devices_list_refresh_row(device);
+}
+
+void devices_list_set_network(uint16_t device, const char * network)
+{
+    if(device >= deviceRowCount){
+        return;
+    }
+
+    deviceRows[device].network = network;
+    devices_list_refresh_row(device);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void devices_list_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if(code == LV_EVENT_GET_SELF_SIZE){
+        /* The scrollable height of the list */
+        lv_point_t * size = (lv_point_t *) lv_event_get_param(e);
+        size->y = LV_MAX(size->y, (lv_coord_t) (deviceCount * DEVICES_ROW_HEIGHT));
+    }
+    else if(code == LV_EVENT_SCROLL){
+        devices_list_refresh();
+    }
+}
+
+/* Places the row widgets at the position of their device */
+static void devices_list_layout(lv_obj_t * list, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    for(uint32_t i = 0; i < DEVICES_LIST_POOL_SIZE; i++)
+    {
+        if(deviceSlots[i].index != DEVICES_ROW_NONE){
+            lv_obj_move_to(deviceSlots[i].row, 0, (lv_coord_t) (deviceSlots[i].index * DEVICES_ROW_HEIGHT));
+        }
+    }
+}
+
+/* A row draws its cells itself, a label per cell would multiply the objects to draw */
+static lv_obj_t * devices_row_create(lv_obj_t * parent, const char ** texts)
+{
+    lv_obj_t * row = lv_obj_create(parent);
+    lv_obj_set_size(row, lv_pct(100), DEVICES_ROW_HEIGHT);
+    lv_obj_add_style(row, &gDeviceRowStyle, LV_STATE_DEFAULT);
+    /* Let the presses scroll the list */
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(row, devices_row_event_cb, LV_EVENT_DRAW_MAIN, texts);
+
+    return row;
+}
+
+static void devices_row_event_cb(lv_event_t * e)
+{
+    lv_obj_t * row = lv_event_get_target(e);
+    const char ** texts = (const char **) lv_event_get_user_data(e);
+    const lv_area_t * clipArea = (const lv_area_t *) lv_event_get_param(e);
+    lv_draw_label_dsc_t labelDsc;
+    lv_area_t content;
+    lv_area_t cell;
+    lv_area_t cellClip;
+
+    lv_draw_label_dsc_init(&labelDsc);
+    lv_obj_init_draw_label_dsc(row, LV_PART_MAIN, &labelDsc);
+    lv_obj_get_content_coords(row, &content);
+
+    lv_coord_t colWidth = lv_area_get_width(&content) / DEVICES_LIST_COLS;
+    lv_coord_t lineHeight = lv_font_get_line_height(labelDsc.font);
+    cell.y1 = content.y1 + (lv_area_get_height(&content) - lineHeight) / 2;
+    cell.y2 = cell.y1 + lineHeight - 1;
+
+    for(uint32_t col = 0; col < DEVICES_LIST_COLS; col++)
+    {
+        cell.x1 = content.x1 + col * colWidth;
+        cell.x2 = cell.x1 + colWidth - 1;
+
+        /* Clip the text to its cell */
+        if((texts[col] != NULL) && _lv_area_intersect(&cellClip, clipArea, &cell)){
+            lv_draw_label(&cell, &cellClip, &labelDsc, texts[col], NULL);
+        }
+    }
+}
+
+/* Binds the row widgets to the visible devices, only the rows which change their texts are redrawn */
+static void devices_list_refresh(void)
+{
+    lv_coord_t scrollY = lv_obj_get_scroll_y(devicesList);
+    uint32_t top = (scrollY > 0) ? (uint32_t) scrollY / DEVICES_ROW_HEIGHT : 0;
+    bool moved = false;
+
+    for(uint32_t index = top; index < top + DEVICES_LIST_POOL_SIZE; index++)
+    {
+        DeviceRowSlot_t * slot = &deviceSlots[index % DEVICES_LIST_POOL_SIZE];
+
+        if(index >= deviceCount){
+            if(slot->index != DEVICES_ROW_NONE){
+                lv_obj_add_flag(slot->row, LV_OBJ_FLAG_HIDDEN);
+                slot->index = DEVICES_ROW_NONE;
+            }
+            continue;
+        }
+
+        if(slot->index != index){
+            /* Recycle the row widget */
+            lv_snprintf(slot->name, sizeof(slot->name), "Light %d", (int) index + 1);
+            lv_obj_invalidate(slot->row);
+            lv_obj_clear_flag(slot->row, LV_OBJ_FLAG_HIDDEN);
+            slot->index = index;
+            moved = true;
+        }
+
+        devices_slot_update(slot);
+    }
+
+    if(moved){
+        lv_obj_mark_layout_as_dirty(devicesList);
+    }
+}
+
+static void devices_list_refresh_row(uint32_t index)
+{
+    DeviceRowSlot_t * slot = &deviceSlots[index % DEVICES_LIST_POOL_SIZE];
+
+    /* A device without row widget is shown when it's scrolled into view */
+    if(slot->index == index){
+        devices_slot_update(slot);
+    }
+}
+
+static void devices_slot_update(DeviceRowSlot_t * slot)
+{
+    const DeviceRow_t * device = &deviceRows[slot->index];
+
+    /* The name only changes with the index, it's set by devices_list_refresh() */
+    if((slot->texts[1] != device->network) || (slot->texts[2] != device->status) || (slot->texts[3] != device->cluster)){
+        slot->texts[1] = device->network;
+        slot->texts[2] = device->status;
+        slot->texts[3] = device->cluster;
+        lv_obj_invalidate(slot->row);
+    }
+}
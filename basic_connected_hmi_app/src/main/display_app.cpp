@@ -6,8 +6,12 @@
 
 #include "lvgl.h"
 #include "FreeRTOS.h"
-#include "semphr.h"
+#include "task.h"
 #include "display_app.h"
+#include "display_queue.h"
+#include "log_view.h"
+#include "devices_list.h"
+#include "lvgl_support.h"
 extern "C"{
 #include "displayResources.h"
 }
@@ -28,13 +32,55 @@ using namespace ::chip::app::Clusters;
 /*********************
  *      DEFINES
  *********************/
-#define MAX_LOG_LENGTH        500
 #ifndef light_count
 #define light_count        EMBER_BINDING_TABLE_SIZE
 #endif 
+/* Devices known by the Devices tab, a row per entry of the binding table. Its list creates
+ * widgets only for the visible rows, so this only sizes the device model */
+#ifndef DEVICES_LIST_ROWS
+#define DEVICES_LIST_ROWS         EMBER_BINDING_TABLE_SIZE
+#endif
+/* The display queue keeps the state of every light and of every device of the list */
+static_assert(light_count <= DISPLAY_QUEUE_DEVICES, "DISPLAY_QUEUE_DEVICES is below the number of lights");
+static_assert(DEVICES_LIST_ROWS <= DISPLAY_QUEUE_DEVICES, "DISPLAY_QUEUE_DEVICES is below DEVICES_LIST_ROWS");
+/* The list is scrolled by LVGL, its height must fit in lv_coord_t */
+static_assert(DEVICES_LIST_ROWS * DEVICES_ROW_HEIGHT < LV_COORD_MAX, "DEVICES_LIST_ROWS is too high for the devices list");
+static_assert(LV_MEM_SLAB_CLASS_CNT <= DISPLAY_MEM_SLAB_CLASSES, "DISPLAY_MEM_SLAB_CLASSES is below LV_MEM_SLAB_CLASS_CNT");
 /**********************
  *      TYPEDEFS
  **********************/
+/* How a status card shows a state: the label text and the shared styles of the label and icon */
+typedef struct {
+    const char * text;
+    lv_style_t * textStyle;
+    lv_style_t * iconStyle;
+} StatusLook_t;
+
+/* Values shown by the widgets. The apply functions compare an update with them
+ * and touch the widgets only when it changes what is on screen.
+ * A NULL look means the card doesn't show a state yet */
+typedef struct {
+    bool shown[kDisplayField_Count];
+    DisplayFieldStats_t stats[kDisplayField_Count];
+    struct {
+        uint16_t year;
+        uint8_t month;
+        uint8_t day;
+    } date;
+    struct {
+        uint8_t hour;
+        uint8_t minutes;
+        uint8_t am_pm;
+    } time;
+    const StatusLook_t * networkState;
+    const StatusLook_t * threadState;
+    const StatusLook_t * bluetoothState;
+    const StatusLook_t * onOffState[light_count];
+    uint16_t matterChannel;
+    uint16_t matterPanId;
+    char matterNetworkName[DISPLAY_QUEUE_TEXT_SIZE];
+    uint16_t matterIpv6Addr[8];
+} DisplayViewModel_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -46,7 +92,16 @@ static void lv_create_matterTab(lv_obj_t * parent);
 static void lv_create_infoCardWidgets(lv_obj_t * parent, const lv_img_dsc_t *icon, lv_obj_t **image, char * name, lv_obj_t ** infoLabel, char *infoText);
 static void lv_create_infoLabel(lv_obj_t * parent, char * infoName, lv_obj_t ** infoLabel, char *defaultValue);
 static void onoff_event_handler(lv_event_t * e);
-static void draw_part_event_cb(lv_event_t * e);
+static void display_wakeup(void);
+static void display_wakeup_from_isr(void);
+static void display_updates_apply(void);
+static void display_mem_stats_take(void);
+static void applyNetworkState(NetworkSate_t state);
+static void applyThreadState(ThreadRole_t role);
+static void applyBluetoothState(BluetoothState_t state);
+static void applyOnOffState(bool state, uint16_t device);
+static bool view_field_changed(DisplayField_t field, bool changed);
+static void view_show_look(lv_obj_t * label, lv_obj_t * image, const StatusLook_t * look, const StatusLook_t * shownLook);
 
 extern lv_style_t gTabStyle;
 extern lv_style_t gInvisibleContainerStyle;
@@ -56,6 +111,19 @@ extern lv_style_t gSmallTextStyle;
 extern lv_style_t gMediumTextStyle;
 extern lv_style_t gLargeTextStyle;
 extern lv_style_t gBigTextStyle;
+extern lv_style_t gTinyTextStyle;
+extern lv_style_t gNormalTextStyle;
+extern lv_style_t gIconBlueStyle;
+extern lv_style_t gIconRedStyle;
+extern lv_style_t gIconGreyStyle;
+extern lv_style_t gIconLightGreyStyle;
+extern lv_style_t gIconDarkGreyStyle;
+extern lv_style_t gIconDarkerGreyStyle;
+extern lv_style_t gIconDeepOrangeStyle;
+extern lv_style_t gIconOrangeStyle;
+extern lv_style_t gDeviceRowStyle;
+extern lv_style_t gDeviceRowAltStyle;
+extern lv_style_t gDeviceHeaderStyle;
 
 /* Icon/Image declaration */
 LV_IMG_DECLARE(networkIcon);
@@ -93,20 +161,72 @@ static lv_obj_t * OnOffImage[light_count];
 static lv_obj_t * OnOffStatusLabel[light_count];
 char OnOffText[light_count];
 
-static lv_obj_t * devices_table;
+/* The model of the devices list */
+static DeviceRow_t deviceRows[DEVICES_LIST_ROWS];
+/* Devices of the binding table beyond DEVICES_LIST_ROWS, they aren't shown */
+static uint32_t devicesNotShown;
+
 static lv_obj_t * infoChannelLabel;
 static lv_obj_t * infoPanIdLabel;
 static lv_obj_t * infoNetworkNameLabel;
 static lv_obj_t * infoIPV6AddrLabel;
 
-#ifdef DISPLAY_MATTER_LOGS
-static lv_obj_t * logLabel;
-static lv_obj_t * TextLogsContainer;
-static char logs[MAX_LOG_LENGTH] = {0};
-#endif
+static DisplayViewModel_t viewModel;
+
+static const char * const displayFieldNames[kDisplayField_Count] = {
+    "Date",
+    "Time",
+    "Network state",
+    "Thread role",
+    "Bluetooth state",
+    "On/Off state",
+    "Channel",
+    "PanID",
+    "Network name",
+    "IPv6 address",
+};
+
+/* Status card looks, indexed by state */
+static const StatusLook_t networkLooks[] = {
+    { "CONNECTED", &gSmallTextStyle, &gIconBlueStyle },     /* connected */
+    { "DISCONNECTED", &gTinyTextStyle, &gIconRedStyle },    /* disconnected */
+    { "UNKNOWN", &gTinyTextStyle, &gIconLightGreyStyle },   /* unknown */
+};
+
+static const StatusLook_t threadLooks[] = {
+    { "DISABLED", &gTinyTextStyle, &gIconLightGreyStyle },  /* disabled */
+    { "DETACHED", &gTinyTextStyle, &gIconLightGreyStyle },  /* detached */
+    { "CHILD", &gSmallTextStyle, &gIconDarkGreyStyle },     /* child */
+    { "ROUTER", &gSmallTextStyle, &gIconDeepOrangeStyle },  /* router */
+    { "LEADER", &gSmallTextStyle, &gIconDarkerGreyStyle },  /* leader */
+};
+
+static const StatusLook_t bluetoothLooks[] = {
+    { "CONNECTED", &gSmallTextStyle, &gIconBlueStyle },         /* bt_connected */
+    { "DISCONNECTED", &gTinyTextStyle, &gIconGreyStyle },       /* bt_disconnected */
+    { "ADVERTISING", &gSmallTextStyle, &gIconDeepOrangeStyle }, /* bt_start_adv */
+    { "STOPPED", &gSmallTextStyle, &gIconGreyStyle },           /* bt_stop_adv */
+};
+
+static const StatusLook_t onOffLooks[] = {
+    { "OFF", &gNormalTextStyle, &gIconLightGreyStyle },
+    { "ON", &gNormalTextStyle, &gIconOrangeStyle },
+};
 
-static SemaphoreHandle_t lvgl_mutex;
 bool s_lvgl_initialized = false;
+
+/* State taken from the display queue, only its dirty fields are up to date */
+static DisplayState_t displayState;
+static DisplayStateDirty_t displayStateDirty;
+
+static TaskHandle_t displayTaskHandle;
+static uint32_t displayWakeups;
+static uint32_t displayWakeupsPerSecond;
+static TickType_t displayWakeupsPeriodStart;
+static uint32_t animRefreshesPerSecond;
+static uint32_t animRefreshesPeriodStart;
+/* Last LVGL heap snapshot, written by the display task and read by the shell in critical sections */
+static DisplayMemStats_t memStats;
 /**********************
  *      MACROS
  **********************/
@@ -159,15 +279,20 @@ static void updateDisplayTimeTask(void *param)
 
 void display_task(void *pvParameters)
 {
+    uint32_t timeTillNext;
+
+    displayTaskHandle = xTaskGetCurrentTaskHandle();
+
     lv_port_pre_init();
     lv_init();
     lv_port_disp_init();
     lv_port_indev_init();
 
-    lvgl_mutex = xSemaphoreCreateMutex();
-    if(lvgl_mutex == NULL){
-        while(1);
-    }
+    lv_port_set_wakeup_cb(display_wakeup_from_isr);
+    display_queue_set_wakeup_cb(display_wakeup);
+
+    /* Measure the CPU/PXP crossover points before the first frame */
+    lv_port_gpu_calibrate();
 
     s_lvgl_initialized = true;
 
@@ -183,10 +308,23 @@ void display_task(void *pvParameters)
 
     for (;;)
     {
-        xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-        lv_task_handler();
-        xSemaphoreGive( lvgl_mutex );
-        vTaskDelay(5);
+        /* Only this task touches LVGL, the other tasks post their updates to the display queue */
+        display_updates_apply();
+        lv_port_process_wakeup();
+        timeTillNext = lv_task_handler();
+
+        displayWakeups++;
+        if((xTaskGetTickCount() - displayWakeupsPeriodStart) >= pdMS_TO_TICKS(1000)){
+            displayWakeupsPerSecond = displayWakeups;
+            displayWakeups = 0;
+            displayWakeupsPeriodStart = xTaskGetTickCount();
+
+            animRefreshesPerSecond = lv_refr_get_anim_refr_cnt() - animRefreshesPeriodStart;
+            animRefreshesPeriodStart = lv_refr_get_anim_refr_cnt();
+        }
+
+        /* Sleep until the next LVGL timer is due, or until a UI update or a touch wakes the task up */
+        ulTaskNotifyTake(pdTRUE, (timeTillNext == LV_NO_TIMER_READY) ? portMAX_DELAY : pdMS_TO_TICKS(timeTillNext));
     }
 
     vTaskDelete(NULL);
@@ -270,6 +408,7 @@ static void lv_create_homeTab(lv_obj_t * parent)
     lv_obj_t * qrcodeIconImage = lv_img_create(LeftPanel);
     lv_img_set_src(qrcodeIconImage, &qrcodeIcon);
     lv_img_set_zoom(qrcodeIconImage, 384);
+    lv_img_set_antialias(qrcodeIconImage, false);
     lv_obj_align(qrcodeIconImage, LV_ALIGN_BOTTOM_MID, 0, -20);
 
     lv_obj_t * qrlabel = lv_label_create(LeftPanel);
@@ -290,7 +429,7 @@ static void lv_create_homeTab(lv_obj_t * parent)
     lv_obj_add_style(NetworkStatusCard, &gCardInfoStyle, LV_STATE_DEFAULT);
     lv_obj_align(NetworkStatusCard, LV_ALIGN_LEFT_MID, 0, 0);
     lv_create_infoCardWidgets(NetworkStatusCard, &networkIcon, &NetworkImage, (char *) "NETWORK", &NetworkStatusLabel, (char *) "UNKNOW");
-    updateNetworkState(unknown);
+    applyNetworkState(unknown);
 
     /* Thread info */
     ThreadStatusCard = lv_obj_create(StatePanel);
@@ -298,7 +437,7 @@ static void lv_create_homeTab(lv_obj_t * parent)
     lv_obj_add_style(ThreadStatusCard, &gCardInfoStyle, LV_STATE_DEFAULT);
     lv_obj_align_to(ThreadStatusCard, NetworkStatusCard, LV_ALIGN_OUT_RIGHT_MID, 9, 0);
     lv_create_infoCardWidgets(ThreadStatusCard, &threadIcon, &ThreadImage, (char *) "ROLE", &ThreadStatusLabel, (char *) "DISABLED");
-    updateThreadState(disabled);
+    applyThreadState(disabled);
 
     /* Bluetooth info */
     BluetoothStatusCard = lv_obj_create(StatePanel);
@@ -306,7 +445,7 @@ static void lv_create_homeTab(lv_obj_t * parent)
     lv_obj_add_style(BluetoothStatusCard, &gCardInfoStyle, LV_STATE_DEFAULT);
     lv_obj_align_to(BluetoothStatusCard, ThreadStatusCard, LV_ALIGN_OUT_RIGHT_MID, 9, 0);
     lv_create_infoCardWidgets(BluetoothStatusCard, &bluetoothIcon, &BluetoothImage, (char *) "STATE", &BluetoothStatusLabel, (char *) "DISCONNECTED");
-    updateBluetoothState(bt_disconnected);
+    applyBluetoothState(bt_disconnected);
 
     /* Right side buttons container */
     lv_obj_t * ButtonPanel = lv_obj_create(parent);
@@ -335,27 +474,17 @@ static void lv_create_homeTab(lv_obj_t * parent)
         lv_obj_add_event_cb(OnOffStatusCard[i], onoff_event_handler, LV_EVENT_VALUE_CHANGED, NULL);
         lv_obj_add_flag(OnOffStatusCard[i], LV_OBJ_FLAG_CHECKABLE);
         lv_obj_add_flag(OnOffStatusCard[i], LV_OBJ_FLAG_HIDDEN);
-        updateOnOffState(false,i);
+        applyOnOffState(false,i);
     }
 }
 
 static void lv_create_devicesTab(lv_obj_t * parent)
 {
-    devices_table = lv_table_create(parent);
-    lv_obj_align(devices_table, LV_ALIGN_TOP_MID, 0, -10);
-
-    lv_table_set_col_width(devices_table, 0, LCD_WIDTH  / 4);
-    lv_table_set_col_width(devices_table, 1, LCD_WIDTH  / 4);
-    lv_table_set_col_width(devices_table, 2, LCD_WIDTH  / 4);
-    lv_table_set_col_width(devices_table, 3, LCD_WIDTH  / 4);
-
-    /*Fill the first row*/
-    lv_table_set_cell_value(devices_table, 0, 0, "Device");
-    lv_table_set_cell_value(devices_table, 0, 1, "Network");
-    lv_table_set_cell_value(devices_table, 0, 2, "Status");
-    lv_table_set_cell_value(devices_table, 0, 3, "Cluster");
+    lv_obj_add_style(parent, &gTabStyle, LV_STATE_DEFAULT);
+    lv_obj_set_flex_flow(parent, LV_FLEX_FLOW_COLUMN);
+    lv_obj_clear_flag(parent, LV_OBJ_FLAG_SCROLLABLE);
 
-    lv_obj_add_event_cb(devices_table, draw_part_event_cb, LV_EVENT_DRAW_PART_BEGIN, NULL);
+    devices_list_create(parent, deviceRows, DEVICES_LIST_ROWS);
 }
 
 static void lv_create_infoTab(lv_obj_t * parent)
@@ -364,6 +493,7 @@ static void lv_create_infoTab(lv_obj_t * parent)
     lv_obj_t * qrcodeIconImage = lv_img_create(parent);
     lv_img_set_src(qrcodeIconImage, &infoqrIcon);
     lv_img_set_zoom(qrcodeIconImage, 384);
+    lv_img_set_antialias(qrcodeIconImage, false);
     lv_obj_align(qrcodeIconImage, LV_ALIGN_LEFT_MID, 10, 40);
 
     lv_obj_t * qrlabel = lv_label_create(parent);
@@ -445,8 +575,6 @@ static void lv_create_infoCardWidgets(lv_obj_t * parent, const lv_img_dsc_t *ico
     lv_img_set_src(*image, icon);
     lv_obj_set_size(*image, icon->header.w, icon->header.h);
     lv_obj_align(*image, LV_ALIGN_TOP_MID, 0, 5);
-    lv_obj_set_style_img_recolor_opa(*image, 255, 0);
-    lv_obj_set_style_img_recolor(*image, lv_palette_main(LV_PALETTE_LIGHT_BLUE), 0);
 
     lv_obj_t * nameLabel = lv_label_create(parent);
     lv_obj_set_size(nameLabel, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
@@ -454,13 +582,13 @@ static void lv_create_infoCardWidgets(lv_obj_t * parent, const lv_img_dsc_t *ico
     lv_label_set_text(nameLabel, name);
     lv_obj_align_to(nameLabel, *image, LV_ALIGN_OUT_BOTTOM_MID, 0, 5);
 
+    /* The styles of the icon and info label come from the state shown by the card */
     *infoLabel = lv_label_create(parent);
     lv_obj_set_size(*infoLabel, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
-    lv_obj_add_style(*infoLabel, &gSmallTextStyle, LV_STATE_DEFAULT);
-    lv_obj_set_size(*infoLabel, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
     lv_label_set_text(*infoLabel, infoText);
 
-    lv_obj_align_to(*infoLabel, parent, LV_ALIGN_BOTTOM_MID, 0, -10);
+    /* Aligned to the parent, so it stays centered when the text changes */
+    lv_obj_align(*infoLabel, LV_ALIGN_BOTTOM_MID, 0, -10);
 }
 
 #ifdef DISPLAY_MATTER_LOGS
@@ -516,15 +644,12 @@ static void lv_create_matterTab(lv_obj_t * parent)
     lv_label_set_text(LogTitleLabel, "Logs:");
     lv_obj_add_style(LogTitleLabel, &gMediumTextStyle, LV_STATE_DEFAULT);
     lv_obj_align(LogTitleLabel, LV_ALIGN_TOP_LEFT, 5, 0);
-    TextLogsContainer = lv_obj_create(LogsContainer);
-    lv_obj_add_style(TextLogsContainer, &gInvisibleContainerStyle, LV_STATE_DEFAULT);
-    lv_obj_set_size(TextLogsContainer, lv_pct(100), lv_pct(80));
-    lv_obj_align_to(TextLogsContainer, LogTitleLabel, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 0);
-    logLabel = lv_label_create(TextLogsContainer);
-    lv_obj_set_size(logLabel, lv_pct(100), LV_SIZE_CONTENT);
-    lv_obj_add_style(logLabel, &gSmallTextStyle, LV_STATE_DEFAULT);
-    lv_label_set_text(logLabel, "No log to show...");
-    lv_obj_align(logLabel, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_obj_t * logView = log_view_create(LogsContainer);
+    lv_obj_add_style(logView, &gInvisibleContainerStyle, LV_STATE_DEFAULT);
+    lv_obj_add_style(logView, &gSmallTextStyle, LV_STATE_DEFAULT);
+    lv_obj_set_size(logView, lv_pct(100), lv_pct(80));
+    lv_obj_align_to(logView, LogTitleLabel, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 0);
+    log_view_add("No log to show...", strlen("No log to show..."));
 }
 #endif
 
@@ -544,190 +669,166 @@ static void lv_create_infoLabel(lv_obj_t * parent, char * infoName, lv_obj_t **
 }
 
 /****************************
- *   APP INTERFACE FUNCTIONS
+ *   UI COMMAND HANDLERS
  ****************************/
 #ifdef SHOW_DATE_TIME
-void updateDate(uint16_t year, uint8_t month, uint8_t day)
+static void applyDate(uint16_t year, uint8_t month, uint8_t day)
 {
     char buf[11];
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    bool changed = !viewModel.shown[kDisplayField_Date] || (year != viewModel.date.year) || (month != viewModel.date.month) ||
+                   (day != viewModel.date.day);
+
+    if(!view_field_changed(kDisplayField_Date, changed)){
+        return;
+    }
+
     lv_snprintf(buf, sizeof(buf), "%04d/%02d/%02d", year, month, day);
     lv_label_set_text(gDateLabel, buf);
-    xSemaphoreGive( lvgl_mutex );
+
+    viewModel.date.year = year;
+    viewModel.date.month = month;
+    viewModel.date.day = day;
+    viewModel.shown[kDisplayField_Date] = true;
 }
 
-void updateTime(uint8_t hour, uint8_t minutes, uint8_t am_or_pm)
+static void applyTime(uint8_t hour, uint8_t minutes, uint8_t am_or_pm)
 {
     char buf[6];
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-    lv_snprintf(buf, sizeof(buf), "%02d:%02d", hour, minutes);
-    lv_label_set_text(gHourLabel, buf);
+    bool shown = viewModel.shown[kDisplayField_Time];
+    bool hourChanged = !shown || (hour != viewModel.time.hour) || (minutes != viewModel.time.minutes);
+    bool amPmChanged = !shown || (am_or_pm != viewModel.time.am_pm);
 
-    if(am_or_pm == 0){
-        lv_label_set_text(gAM_PM_Label, "AM");
+    if(!view_field_changed(kDisplayField_Time, hourChanged || amPmChanged)){
+        return;
     }
-    else{
-        lv_label_set_text(gAM_PM_Label, "PM");
+
+    if(hourChanged){
+        lv_snprintf(buf, sizeof(buf), "%02d:%02d", hour, minutes);
+        lv_label_set_text(gHourLabel, buf);
     }
 
+    if(amPmChanged){
+        if(am_or_pm == 0){
+            lv_label_set_text_static(gAM_PM_Label, "AM");
+        }
+        else{
+            lv_label_set_text_static(gAM_PM_Label, "PM");
+        }
+    }
+
+    /* The hour digits aren't monospaced, so both changes can move the label */
     lv_obj_align_to(gAM_PM_Label, gHourLabel, LV_ALIGN_OUT_RIGHT_BOTTOM, 0, -5);
-    xSemaphoreGive( lvgl_mutex );
+
+    viewModel.time.hour = hour;
+    viewModel.time.minutes = minutes;
+    viewModel.time.am_pm = am_or_pm;
+    viewModel.shown[kDisplayField_Time] = true;
 }
 #endif
 
-void updateNetworkState(NetworkSate_t state)
+static void applyNetworkState(NetworkSate_t state)
 {
-    lv_style_value_t value;
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
-
-    switch(state)
-    {
-        case connected:{
-            lv_label_set_text(NetworkStatusLabel, "CONNECTED");
-            value.ptr = &lv_font_montserrat_12;
-            lv_obj_set_style_img_recolor(NetworkImage, lv_palette_main(LV_PALETTE_LIGHT_BLUE), 0);
-        } break;
-        case disconnected:{
-            lv_label_set_text(NetworkStatusLabel, "DISCONNECTED");
-            value.ptr = &lv_font_montserrat_10;
-            lv_obj_set_style_img_recolor(NetworkImage, lv_palette_main(LV_PALETTE_RED), 0);
-        } break;
-        case unknown:{
-            lv_label_set_text(NetworkStatusLabel, "UNKNOWN");
-            value.ptr = &lv_font_montserrat_10;
-            lv_obj_set_style_img_recolor(NetworkImage, lv_palette_lighten(LV_PALETTE_GREY, 1), 0);
+    const StatusLook_t * look = &networkLooks[state];
 
-        } break;
+    if(view_field_changed(kDisplayField_NetworkState, look != viewModel.networkState)){
+        view_show_look(NetworkStatusLabel, NetworkImage, look, viewModel.networkState);
+        viewModel.networkState = look;
     }
-
-    lv_obj_set_local_style_prop(NetworkStatusLabel, LV_STYLE_TEXT_FONT, value, LV_PART_MAIN);
-    lv_obj_align_to(NetworkStatusLabel, NetworkStatusCard, LV_ALIGN_BOTTOM_MID, 0, -10);
-    xSemaphoreGive( lvgl_mutex );
 }
 
-void updateThreadState(ThreadRole_t role)
+static void applyThreadState(ThreadRole_t role)
 {
-    lv_style_value_t value;
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    const StatusLook_t * look = &threadLooks[role];
 
-    switch(role){
-        case disabled:
-            lv_label_set_text(ThreadStatusLabel, "DISABLED");
-            value.ptr = &lv_font_montserrat_10;
-            lv_obj_set_style_img_recolor(ThreadImage,  lv_palette_lighten(LV_PALETTE_GREY, 1), 0);
-            break;
-        case detached:
-            lv_label_set_text(ThreadStatusLabel, "DETACHED");
-            value.ptr = &lv_font_montserrat_10;
-            lv_obj_set_style_img_recolor(ThreadImage, lv_palette_lighten(LV_PALETTE_GREY, 1), 0);
-            break;
-        case child:
-            lv_label_set_text(ThreadStatusLabel, "CHILD");
-            value.ptr = &lv_font_montserrat_12;
-            lv_obj_set_style_img_recolor(ThreadImage, lv_palette_darken(LV_PALETTE_GREY, 1), 0);
-            break;
-        case router:
-            lv_label_set_text(ThreadStatusLabel, "ROUTER");
-            value.ptr = &lv_font_montserrat_12;
-            lv_obj_set_style_img_recolor(ThreadImage, lv_palette_main(LV_PALETTE_DEEP_ORANGE), 0);
-            break;
-        case leader:
-            lv_label_set_text(ThreadStatusLabel, "LEADER");
-            value.ptr = &lv_font_montserrat_12;
-            lv_obj_set_style_img_recolor(ThreadImage, lv_palette_darken(LV_PALETTE_GREY, 2), 0);
-            break;
+    if(view_field_changed(kDisplayField_ThreadState, look != viewModel.threadState)){
+        view_show_look(ThreadStatusLabel, ThreadImage, look, viewModel.threadState);
+        viewModel.threadState = look;
     }
-
-    lv_obj_set_local_style_prop(ThreadStatusLabel, LV_STYLE_TEXT_FONT, value, LV_PART_MAIN);
-    lv_obj_align_to(ThreadStatusLabel, ThreadStatusCard, LV_ALIGN_BOTTOM_MID, 0, -10);
-    xSemaphoreGive( lvgl_mutex );
 }
 
-void updateBluetoothState(BluetoothState_t state)
+static void applyBluetoothState(BluetoothState_t state)
 {
-    lv_style_value_t value;
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    const StatusLook_t * look = &bluetoothLooks[state];
 
-    switch(state)
-    {
-        case bt_connected:{
-            lv_label_set_text(BluetoothStatusLabel, "CONNECTED");
-            value.ptr = &lv_font_montserrat_12;
-            lv_obj_set_style_img_recolor(BluetoothImage, lv_palette_main(LV_PALETTE_LIGHT_BLUE), 0);
-        } break;
-        case bt_disconnected:{
-            lv_label_set_text(BluetoothStatusLabel, "DISCONNECTED");
-            value.ptr = &lv_font_montserrat_10;
-            lv_obj_set_style_img_recolor(BluetoothImage, lv_palette_main(LV_PALETTE_GREY), 0);
-        } break;
-        case bt_start_adv:{
-            lv_label_set_text(BluetoothStatusLabel, "ADVERTISING");
-            value.ptr = &lv_font_montserrat_12;
-            lv_obj_set_style_img_recolor(BluetoothImage, lv_palette_main(LV_PALETTE_DEEP_ORANGE), 0);
-        } break;
-        case bt_stop_adv:{
-            lv_label_set_text(BluetoothStatusLabel, "STOPPED");
-            value.ptr = &lv_font_montserrat_12;
-            lv_obj_set_style_img_recolor(BluetoothImage, lv_palette_main(LV_PALETTE_GREY), 0);
-        } break;
+    if(view_field_changed(kDisplayField_BluetoothState, look != viewModel.bluetoothState)){
+        view_show_look(BluetoothStatusLabel, BluetoothImage, look, viewModel.bluetoothState);
+        viewModel.bluetoothState = look;
     }
-
-    lv_obj_set_local_style_prop(BluetoothStatusLabel, LV_STYLE_TEXT_FONT, value, LV_PART_MAIN);
-    lv_obj_align_to(BluetoothStatusLabel, BluetoothStatusCard, LV_ALIGN_BOTTOM_MID, 0, -10);
-    xSemaphoreGive( lvgl_mutex );
 }
 
-void updateOnOffState(bool state, uint8_t device)
+static void applyOnOffState(bool state, uint16_t device)
 {
-    lv_style_value_t value;
+    const StatusLook_t * look = &onOffLooks[state ? 1 : 0];
 
-    if(state)
-    {
-        lv_label_set_text(OnOffStatusLabel[device], "ON");
-        value.ptr = &lv_font_montserrat_16;
-        lv_obj_set_style_img_recolor(OnOffImage[device],  lv_palette_lighten(LV_PALETTE_ORANGE, 1), 0);
-    }
-    else
-    {
-        lv_label_set_text(OnOffStatusLabel[device], "OFF");
-        value.ptr = &lv_font_montserrat_16;
-        lv_obj_set_style_img_recolor(OnOffImage[device], lv_palette_lighten(LV_PALETTE_GREY, 1), 0);
+    if(device >= light_count){
+        return;
     }
 
-    lv_obj_set_local_style_prop(OnOffStatusLabel[device], LV_STYLE_TEXT_FONT, value, LV_PART_MAIN);
-    lv_obj_align_to(OnOffStatusLabel[device], OnOffStatusCard[device], LV_ALIGN_BOTTOM_MID, 0, -10);
+    if(view_field_changed(kDisplayField_OnOffState, look != viewModel.onOffState[device])){
+        view_show_look(OnOffStatusLabel[device], OnOffImage[device], look, viewModel.onOffState[device]);
+        viewModel.onOffState[device] = look;
+    }
 }
 
-void updateMatterChannel(uint16_t channel)
+static void applyMatterChannel(uint16_t channel)
 {
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
     char buf[5];
+    bool changed = !viewModel.shown[kDisplayField_MatterChannel] || (channel != viewModel.matterChannel);
+
+    if(!view_field_changed(kDisplayField_MatterChannel, changed)){
+        return;
+    }
+
     lv_snprintf(buf, sizeof(buf), "%d", channel);
     lv_label_set_text(infoChannelLabel, buf);
-    xSemaphoreGive( lvgl_mutex );
+
+    viewModel.matterChannel = channel;
+    viewModel.shown[kDisplayField_MatterChannel] = true;
 }
 
-void updateMatterPanID(uint16_t panId)
+static void applyMatterPanID(uint16_t panId)
 {
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
     char buf[7];
+    bool changed = !viewModel.shown[kDisplayField_MatterPanID] || (panId != viewModel.matterPanId);
+
+    if(!view_field_changed(kDisplayField_MatterPanID, changed)){
+        return;
+    }
+
     lv_snprintf(buf, sizeof(buf), "0x%X", panId);
     lv_label_set_text(infoPanIdLabel, buf);
-    xSemaphoreGive( lvgl_mutex );
+
+    viewModel.matterPanId = panId;
+    viewModel.shown[kDisplayField_MatterPanID] = true;
 }
 
-void updateMatterNetworkName(char * name)
+static void applyMatterNetworkName(char * name)
 {
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    bool changed = !viewModel.shown[kDisplayField_MatterNetworkName] ||
+                   (strncmp(name, viewModel.matterNetworkName, sizeof(viewModel.matterNetworkName)) != 0);
+
+    if(!view_field_changed(kDisplayField_MatterNetworkName, changed)){
+        return;
+    }
+
     lv_label_set_text(infoNetworkNameLabel, name);
-    xSemaphoreGive( lvgl_mutex );
+
+    strncpy(viewModel.matterNetworkName, name, sizeof(viewModel.matterNetworkName) - 1);
+    viewModel.matterNetworkName[sizeof(viewModel.matterNetworkName) - 1] = '\0';
+    viewModel.shown[kDisplayField_MatterNetworkName] = true;
 }
 
-void updateMatterIPV6Addr(uint16_t * addr)
+static void applyMatterIPV6Addr(uint16_t * addr)
 {
     char buf[41];
     bool contiguous_zero = false;
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    bool changed = !viewModel.shown[kDisplayField_MatterIPV6Addr] ||
+                   (memcmp(addr, viewModel.matterIpv6Addr, sizeof(viewModel.matterIpv6Addr)) != 0);
+
+    if(!view_field_changed(kDisplayField_MatterIPV6Addr, changed)){
+        return;
+    }
+
     lv_snprintf(buf, sizeof(buf), "%04X", addr[0]);
 
     for(uint8_t i = 1; i<8; i++){
@@ -742,34 +843,56 @@ void updateMatterIPV6Addr(uint16_t * addr)
     }
 
     lv_label_set_text(infoIPV6AddrLabel, buf);
-    xSemaphoreGive( lvgl_mutex );
+
+    memcpy(viewModel.matterIpv6Addr, addr, sizeof(viewModel.matterIpv6Addr));
+    viewModel.shown[kDisplayField_MatterIPV6Addr] = true;
 }
 
-#ifdef DISPLAY_MATTER_LOGS
-void addMatterLogs(char * logs, uint16_t length, bool clear)
+/* Counts the update of a field, returns true if it changes the field and must be applied */
+static bool view_field_changed(DisplayField_t field, bool changed)
 {
-    xSemaphoreTake(lvgl_mutex, portMAX_DELAY);
+    if(changed){
+        viewModel.stats[field].applied++;
+    }
+    else{
+        viewModel.stats[field].skipped++;
+    }
 
-    if(clear){
-        lv_label_set_text(logLabel, textLogs);
-    } else{
-        if(strlen(lv_label_get_text(logLabel)) + length >= MAX_LOG_LENGTH){
-            /* Need to remove first elem */
-            lv_label_cut_text(logLabel, 0, length + 1);
+    return changed;
+}
+
+/* Shows a state on a status card, `shownLook` is the state shown until now or NULL.
+ * The look texts are constants, so the label keeps a pointer instead of a copy */
+static void view_show_look(lv_obj_t * label, lv_obj_t * image, const StatusLook_t * look, const StatusLook_t * shownLook)
+{
+    lv_label_set_text_static(label, look->text);
+
+    if((shownLook == NULL) || (shownLook->textStyle != look->textStyle)){
+        if(shownLook != NULL){
+            lv_obj_remove_style(label, shownLook->textStyle, LV_STATE_DEFAULT);
         }
-        lv_label_ins_text(logLabel, LV_LABEL_POS_LAST, "\r\n");
-        lv_label_ins_text(logLabel, LV_LABEL_POS_LAST, textLogs);
+        lv_obj_add_style(label, look->textStyle, LV_STATE_DEFAULT);
     }
-    int16_t scroll = lv_obj_get_scroll_bottom(TextLogsContainer);
-    if(scroll > 0){
-        lv_obj_scroll_by(TextLogsContainer, 0, -scroll , LV_ANIM_OFF);
+
+    if((shownLook == NULL) || (shownLook->iconStyle != look->iconStyle)){
+        if(shownLook != NULL){
+            lv_obj_remove_style(image, shownLook->iconStyle, LV_STATE_DEFAULT);
+        }
+        lv_obj_add_style(image, look->iconStyle, LV_STATE_DEFAULT);
     }
+}
 
-    xSemaphoreGive( lvgl_mutex );
+#ifdef DISPLAY_MATTER_LOGS
+static void applyMatterLogs(char * textLogs, uint16_t length, bool clear)
+{
+    if(clear){
+        log_view_clear();
+    }
+    log_view_add(textLogs, length);
 }
 #endif
 
-void updateButtons(uint8_t count)
+static void applyButtons(uint8_t count)
 {
     for(int i = 0; i<count; i++)
     {
@@ -782,89 +905,349 @@ void updateButtons(uint8_t count)
     }
 }
 
-void updateConnectionStatus(uint8_t device, bool isConnected)
+static void applyConnectionStatus(uint16_t device, bool isConnected)
 {
     if(isConnected){
-        lv_table_set_cell_value(devices_table, device+1, 2, "Connected");
+        devices_list_set_status(device, "Connected");
     }
     else{
-        lv_table_set_cell_value(devices_table, device+1, 2, "Connected");
+        devices_list_set_status(device, "Disconnected");
     }
 }
 
-void updateNetworkType(uint8_t device, uint8_t state)
+static void applyNetworkType(uint16_t device, uint8_t state)
 {
+    const char * network;
+
     switch(state){
         case EMBER_ZCL_INTERFACE_TYPE_UNSPECIFIED:{
-            lv_table_set_cell_value(devices_table, device+1, 1, "Unspecified");
+            network = "Unspecified";
         } break;
         case EMBER_ZCL_INTERFACE_TYPE_WI_FI:{
-            lv_table_set_cell_value(devices_table, device+1, 1, "Wi-Fi");
+            network = "Wi-Fi";
         } break;
         case EMBER_ZCL_INTERFACE_TYPE_ETHERNET:{
-            lv_table_set_cell_value(devices_table, device+1, 1, "Ethernet");
+            network = "Ethernet";
         } break;
         case EMBER_ZCL_INTERFACE_TYPE_CELLULAR:{
-            lv_table_set_cell_value(devices_table, device+1, 1, "LTE");
+            network = "LTE";
         } break;
         case EMBER_ZCL_INTERFACE_TYPE_THREAD:{
-            lv_table_set_cell_value(devices_table, device+1, 1, "Thread");
+            network = "Thread";
         } break;
+        default:
+            return;
     }
+
+    devices_list_set_network(device, network);
 }
 
-void updateTable(uint8_t count)
+/* Shows a binding table of `total` devices, bit i of `isOnOff` is set if the device i is an on/off light */
+static void applyTable(uint16_t total, const uint32_t * isOnOff)
 {
-    for(int i = 0; i<count; i++)
-    {
-        const EmberBindingTableEntry & entry = BindingTable::GetInstance().GetAt(i);
-        snprintf(OnOffText, sizeof(OnOffText), "Light %d",i+1);
+    /* The devices beyond the model aren't shown, report them once */
+    uint32_t notShown = total - devices_list_set_table(total, isOnOff);
+    if(notShown != devicesNotShown){
+        devicesNotShown = notShown;
+        if(devicesNotShown != 0){
+            ChipLogError(DeviceLayer, "Devices list: %u devices not shown, DEVICES_LIST_ROWS is %u",
+                         (unsigned) devicesNotShown, (unsigned) DEVICES_LIST_ROWS);
+        }
+    }
+}
 
-        lv_table_set_cell_value(devices_table, i+1, 0, (char*) OnOffText);
-        lv_table_set_cell_value(devices_table, i+1, 1, "Unknown");
-        lv_table_set_cell_value(devices_table, i+1, 2, "Unknown");
+/****************************
+ *   UI UPDATES
+ ****************************/
+/* Apply the updates posted so far, called by the display task before each render.
+ * The table is applied before the device updates, the ones posted before it were dropped */
+static void display_updates_apply(void)
+{
+#ifdef DISPLAY_MATTER_LOGS
+    DisplayLog_t log;
 
-        if(entry.clusterId.Value() == chip::app::Clusters::OnOff::Id){
-            lv_table_set_cell_value(devices_table, i+1, 3, "On-Off");
-        }
-        else{
-            lv_table_set_cell_value(devices_table, i+1, 3, "Unknown");
+    while(display_queue_take_log(&log)){
+        applyMatterLogs(log.text, log.length, log.clear);
+    }
+#endif
+
+    if(!display_queue_take_state(&displayState, &displayStateDirty)){
+        return;
+    }
+
+    uint32_t fields = displayStateDirty.fields;
+
+#ifdef SHOW_DATE_TIME
+    if(fields & (1U << kDisplayState_Date)){
+        applyDate(displayState.date.year, displayState.date.month, displayState.date.day);
+    }
+    if(fields & (1U << kDisplayState_Time)){
+        applyTime(displayState.time.hour, displayState.time.minutes, displayState.time.am_pm);
+    }
+#endif
+    if(fields & (1U << kDisplayState_NetworkState)){
+        applyNetworkState(displayState.networkState);
+    }
+    if(fields & (1U << kDisplayState_ThreadState)){
+        applyThreadState(displayState.threadRole);
+    }
+    if(fields & (1U << kDisplayState_BluetoothState)){
+        applyBluetoothState(displayState.bluetoothState);
+    }
+    if(fields & (1U << kDisplayState_MatterChannel)){
+        applyMatterChannel(displayState.matterChannel);
+    }
+    if(fields & (1U << kDisplayState_MatterPanID)){
+        applyMatterPanID(displayState.matterPanId);
+    }
+    if(fields & (1U << kDisplayState_MatterNetworkName)){
+        applyMatterNetworkName(displayState.matterNetworkName);
+    }
+    if(fields & (1U << kDisplayState_MatterIPV6Addr)){
+        applyMatterIPV6Addr(displayState.matterIpv6Addr);
+    }
+    if(fields & (1U << kDisplayState_Buttons)){
+        applyButtons(displayState.buttons);
+    }
+    if(fields & (1U << kDisplayState_Table)){
+        applyTable(displayState.table.total, displayState.table.onOff);
+    }
+
+    for(uint32_t word = 0; word < DISPLAY_QUEUE_DEVICE_WORDS; word++){
+        uint32_t bits = displayStateDirty.devices[kDisplayDevice_OnOff][word] |
+                        displayStateDirty.devices[kDisplayDevice_Connection][word] |
+                        displayStateDirty.devices[kDisplayDevice_NetworkType][word];
+
+        while(bits != 0){
+            uint16_t device = word * 32 + __builtin_ctz(bits);
+            bits &= bits - 1;
+
+            if(DISPLAY_QUEUE_DEVICE_DIRTY(&displayStateDirty, kDisplayDevice_OnOff, device)){
+                applyOnOffState(displayState.devices[kDisplayDevice_OnOff][device], device);
+            }
+            if(DISPLAY_QUEUE_DEVICE_DIRTY(&displayStateDirty, kDisplayDevice_Connection, device)){
+                applyConnectionStatus(device, displayState.devices[kDisplayDevice_Connection][device]);
+            }
+            if(DISPLAY_QUEUE_DEVICE_DIRTY(&displayStateDirty, kDisplayDevice_NetworkType, device)){
+                applyNetworkType(device, displayState.devices[kDisplayDevice_NetworkType][device]);
+            }
         }
     }
 
-    for(int i=count; i<light_count; i++)
-    {
-        lv_table_set_cell_value(devices_table, i+1, 0, "");
-        lv_table_set_cell_value(devices_table, i+1, 1, "");
-        lv_table_set_cell_value(devices_table, i+1, 2, "");
-        lv_table_set_cell_value(devices_table, i+1, 3, "");
+    if(fields & (1U << kDisplayState_GpuCalibrate)){
+        lv_port_gpu_calibrate();
+    }
+    if(fields & (1U << kDisplayState_MemStats)){
+        display_mem_stats_take();
     }
 }
 
-static void draw_part_event_cb(lv_event_t * e)
+/* The heap and the slabs are only consistent in the display task, which allocates without lock */
+static void display_mem_stats_take(void)
 {
-    lv_obj_t * obj = lv_event_get_target(e);
-    lv_obj_draw_part_dsc_t * dsc = lv_event_get_draw_part_dsc(e);
-    /*If the cells are drawn...*/
-    if(dsc->part == LV_PART_ITEMS) {
-        uint32_t row = dsc->id /  lv_table_get_col_cnt(obj);
-        uint32_t col = dsc->id - row * lv_table_get_col_cnt(obj);
-
-        /*Make the texts in the first cell center aligned*/
-        if(row == 0) {
-            dsc->label_dsc->align = LV_TEXT_ALIGN_CENTER;
-            dsc->rect_dsc->bg_color = lv_color_mix(lv_palette_main(LV_PALETTE_BLUE), dsc->rect_dsc->bg_color, LV_OPA_20);
-            dsc->rect_dsc->bg_opa = LV_OPA_COVER;
-        }
-        /*In the first column align the texts to the right*/
-        else if(col == 0) {
-            dsc->label_dsc->flag = LV_TEXT_ALIGN_RIGHT;
-        }
+    DisplayMemStats_t stats;
+    lv_mem_monitor_t mon;
+
+    lv_mem_monitor(&mon);
+    stats.totalSize = mon.total_size;
+    stats.freeSize = mon.free_size;
+    stats.fragPct = mon.frag_pct;
+    stats.slabSize = mon.slab_size;
+    stats.slabUsed = mon.slab_used;
+    stats.slabFragPct = mon.slab_frag_pct;
+    stats.slabFallbacks = mon.slab_fallback_cnt;
+    stats.slabClassCnt = LV_MEM_SLAB_CLASS_CNT;
+
+    for(uint8_t i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++){
+        lv_mem_slab_class_monitor_t classMon;
+        lv_mem_slab_class_monitor(i, &classMon);
+        stats.slabClasses[i].blockSize = classMon.block_size;
+        stats.slabClasses[i].pageCnt = classMon.page_cnt;
+        stats.slabClasses[i].usedCnt = classMon.used_cnt;
+        stats.slabClasses[i].freeCnt = classMon.free_cnt;
+    }
+
+    taskENTER_CRITICAL();
+    stats.sequence = memStats.sequence + 1;
+    memStats = stats;
+    taskEXIT_CRITICAL();
+}
+
+void getDisplayQueueStats(DisplayQueueStats_t * stats)
+{
+    display_queue_get_stats(stats);
+}
 
-        /*Make every 2nd row grayish*/
-        if((row != 0 && row % 2) == 0) {
-            dsc->rect_dsc->bg_color = lv_color_mix(lv_palette_main(LV_PALETTE_GREY), dsc->rect_dsc->bg_color, LV_OPA_10);
-            dsc->rect_dsc->bg_opa = LV_OPA_COVER;
+uint32_t getDisplayWakeupsPerSecond(void)
+{
+    return displayWakeupsPerSecond;
+}
+
+uint32_t getAnimRefreshesPerSecond(void)
+{
+    return animRefreshesPerSecond;
+}
+
+const char * getDisplayFieldStats(DisplayField_t field, DisplayFieldStats_t * stats)
+{
+    *stats = viewModel.stats[field];
+    return displayFieldNames[field];
+}
+
+static void display_wakeup(void)
+{
+    if(displayTaskHandle != NULL){
+        xTaskNotifyGive(displayTaskHandle);
+    }
+}
+
+static void display_wakeup_from_isr(void)
+{
+    BaseType_t taskAwake = pdFALSE;
+
+    vTaskNotifyGiveFromISR(displayTaskHandle, &taskAwake);
+    portYIELD_FROM_ISR(taskAwake);
+}
+
+/****************************
+ *   APP INTERFACE FUNCTIONS
+ ****************************/
+/* The update functions can be called from any task: they only post the new value to the display task */
+#ifdef SHOW_DATE_TIME
+void updateDate(uint16_t year, uint8_t month, uint8_t day)
+{
+    DisplayState_t * state = display_queue_lock();
+
+    state->date.year = year;
+    state->date.month = month;
+    state->date.day = day;
+    display_queue_unlock(kDisplayState_Date);
+}
+
+void updateTime(uint8_t hour, uint8_t minutes, uint8_t am_or_pm)
+{
+    DisplayState_t * state = display_queue_lock();
+
+    state->time.hour = hour;
+    state->time.minutes = minutes;
+    state->time.am_pm = am_or_pm;
+    display_queue_unlock(kDisplayState_Time);
+}
+#endif
+
+void updateNetworkState(NetworkSate_t state)
+{
+    display_queue_lock()->networkState = state;
+    display_queue_unlock(kDisplayState_NetworkState);
+}
+
+void updateThreadState(ThreadRole_t role)
+{
+    display_queue_lock()->threadRole = role;
+    display_queue_unlock(kDisplayState_ThreadState);
+}
+
+void updateBluetoothState(BluetoothState_t state)
+{
+    display_queue_lock()->bluetoothState = state;
+    display_queue_unlock(kDisplayState_BluetoothState);
+}
+
+void updateOnOffState(bool state, uint16_t device)
+{
+    display_queue_post_device(kDisplayDevice_OnOff, device, state);
+}
+
+void updateMatterChannel(uint16_t channel)
+{
+    display_queue_lock()->matterChannel = channel;
+    display_queue_unlock(kDisplayState_MatterChannel);
+}
+
+void updateMatterPanID(uint16_t panId)
+{
+    display_queue_lock()->matterPanId = panId;
+    display_queue_unlock(kDisplayState_MatterPanID);
+}
+
+void updateMatterNetworkName(char * name)
+{
+    DisplayState_t * state = display_queue_lock();
+
+    strncpy(state->matterNetworkName, name, sizeof(state->matterNetworkName) - 1);
+    state->matterNetworkName[sizeof(state->matterNetworkName) - 1] = '\0';
+    display_queue_unlock(kDisplayState_MatterNetworkName);
+}
+
+void updateMatterIPV6Addr(uint16_t * addr)
+{
+    DisplayState_t * state = display_queue_lock();
+
+    memcpy(state->matterIpv6Addr, addr, sizeof(state->matterIpv6Addr));
+    display_queue_unlock(kDisplayState_MatterIPV6Addr);
+}
+
+#ifdef DISPLAY_MATTER_LOGS
+/* The first DISPLAY_QUEUE_TEXT_SIZE - 1 characters of the line are shown, a longer line is cut */
+void addMatterLogs(char * textLogs, uint16_t length, bool clear)
+{
+    display_queue_post_log(textLogs, length, clear);
+}
+#endif
+
+void updateButtons(uint8_t count)
+{
+    display_queue_lock()->buttons = count;
+    display_queue_unlock(kDisplayState_Buttons);
+}
+
+void updateConnectionStatus(uint16_t device, bool isConnected)
+{
+    display_queue_post_device(kDisplayDevice_Connection, device, isConnected);
+}
+
+void updateNetworkType(uint16_t device, uint8_t state)
+{
+    display_queue_post_device(kDisplayDevice_NetworkType, device, state);
+}
+
+void requestGpuCalibration(void)
+{
+    display_queue_lock();
+    display_queue_unlock(kDisplayState_GpuCalibrate);
+}
+
+void requestMemStats(void)
+{
+    display_queue_lock();
+    display_queue_unlock(kDisplayState_MemStats);
+}
+
+void getMemStats(DisplayMemStats_t * stats)
+{
+    taskENTER_CRITICAL();
+    *stats = memStats;
+    taskEXIT_CRITICAL();
+}
+
+void updateTable(uint16_t count)
+{
+    uint32_t isOnOff[DISPLAY_QUEUE_DEVICE_WORDS] = { 0 };
+    uint16_t rows = LV_MIN(count, DISPLAY_QUEUE_DEVICES);
+
+    /* The binding table is read here, in the Matter context, the critical section only copies it */
+    for(uint16_t i = 0; i < rows; i++)
+    {
+        const EmberBindingTableEntry & entry = BindingTable::GetInstance().GetAt(i);
+        if(entry.clusterId.Value() == chip::app::Clusters::OnOff::Id){
+            isOnOff[i / 32] |= 1U << (i % 32);
         }
     }
+
+    DisplayState_t * state = display_queue_lock();
+
+    state->table.total = count;
+    memcpy(state->table.onOff, isOnOff, sizeof(state->table.onOff));
+    display_queue_unlock(kDisplayState_Table);
 }
+
@@ -0,0 +1,326 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "display_queue.h"
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define DISPLAY_QUEUE_LOG_MASK    (DISPLAY_QUEUE_LOG_SIZE - 1)
+#define STATE_FIELD(member)       { offsetof(DisplayState_t, member), sizeof(((DisplayState_t *) 0)->member) }
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    std::atomic<uint32_t> sequence;
+    TickType_t postTick;
+    DisplayLog_t log;
+} DisplayLogSlot_t;
+
+typedef struct {
+    uint16_t offset;
+    uint16_t size;
+} DisplayStateFieldDsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void state_mark_dirty(uint32_t * dirtyWord, uint32_t bit);
+static void state_posted(void);
+static void count_latency(TickType_t postTick);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* Where each field is in DisplayState_t, indexed by DisplayStateField_t */
+static const DisplayStateFieldDsc_t stateFields[kDisplayState_Count] = {
+    STATE_FIELD(date),
+    STATE_FIELD(time),
+    STATE_FIELD(networkState),
+    STATE_FIELD(threadRole),
+    STATE_FIELD(bluetoothState),
+    STATE_FIELD(matterChannel),
+    STATE_FIELD(matterPanId),
+    STATE_FIELD(matterNetworkName),
+    STATE_FIELD(matterIpv6Addr),
+    STATE_FIELD(buttons),
+    STATE_FIELD(table),
+    { 0, 0 },   /* GPU calibration request, no value */
+    { 0, 0 },   /* LVGL heap snapshot request, no value */
+};
+
+/* State posted and not taken yet by the display task, protected by the critical section.
+ * `pendingTick` is when the first of these updates was posted */
+static DisplayState_t pendingState;
+static DisplayStateDirty_t pendingDirty;
+static bool pendingAny;
+static TickType_t pendingTick;
+static uint32_t statePosted;
+static uint32_t stateCoalesced;
+static uint32_t stateRejected;
+
+static DisplayLogSlot_t logQueue[DISPLAY_QUEUE_LOG_SIZE];
+static std::atomic<uint32_t> logHead;
+static uint32_t logTail;
+static std::atomic<uint32_t> logPosted;
+static std::atomic<uint32_t> logOverflows;
+static std::atomic<uint32_t> logTruncated;
+
+/* Updated by the display task only, in the critical section so that the stats read them together */
+static uint32_t latencyCount;
+static uint32_t latencyMax;
+static uint64_t latencySum;
+
+static display_queue_wakeup_cb_t wakeupCb;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void display_queue_set_wakeup_cb(display_queue_wakeup_cb_t cb)
+{
+    wakeupCb = cb;
+}
+
+/****************************
+ *   STATE
+ ****************************/
+/*
+ * The state is a snapshot of the latest values with a dirty bit per field and per device:
+ * an update overwrites the value not shown yet, so it's never dropped and a burst of updates
+ * costs one redraw. The display task takes the dirty fields at once before rendering.
+ * Writes are short copies in a critical section, the interrupts are disabled for a bounded time.
+ */
+DisplayState_t * display_queue_lock(void)
+{
+    taskENTER_CRITICAL();
+    return &pendingState;
+}
+
+void display_queue_unlock(DisplayStateField_t field)
+{
+    state_mark_dirty(&pendingDirty.fields, field);
+
+    if(field == kDisplayState_Table){
+        /* The table shows the status and the network of every device as unknown: the connection and network
+         * updates posted before it would be overwritten when the table is applied, so they are dropped.
+         * The ones posted after the table are applied after it */
+        memset(pendingDirty.devices[kDisplayDevice_Connection], 0, sizeof(pendingDirty.devices[kDisplayDevice_Connection]));
+        memset(pendingDirty.devices[kDisplayDevice_NetworkType], 0, sizeof(pendingDirty.devices[kDisplayDevice_NetworkType]));
+    }
+
+    state_posted();
+}
+
+bool display_queue_post_device(DisplayDeviceField_t field, uint16_t device, uint8_t value)
+{
+    taskENTER_CRITICAL();
+
+    if(device >= DISPLAY_QUEUE_DEVICES){
+        stateRejected++;
+        taskEXIT_CRITICAL();
+        return false;
+    }
+
+    pendingState.devices[field][device] = value;
+    state_mark_dirty(&pendingDirty.devices[field][device / 32], device % 32);
+    state_posted();
+
+    return true;
+}
+
+/* Copies the fields changed since the previous call to `state`, returns false if nothing changed */
+bool display_queue_take_state(DisplayState_t * state, DisplayStateDirty_t * dirty)
+{
+    TickType_t postTick;
+
+    taskENTER_CRITICAL();
+
+    if(!pendingAny){
+        taskEXIT_CRITICAL();
+        return false;
+    }
+
+    *dirty = pendingDirty;
+    memset(&pendingDirty, 0, sizeof(pendingDirty));
+    pendingAny = false;
+    postTick = pendingTick;
+
+    for(uint32_t field = 0; field < kDisplayState_Count; field++){
+        if(dirty->fields & (1U << field)){
+            memcpy((uint8_t *) state + stateFields[field].offset, (const uint8_t *) &pendingState + stateFields[field].offset,
+                   stateFields[field].size);
+        }
+    }
+
+    for(uint32_t field = 0; field < kDisplayDevice_Count; field++){
+        for(uint32_t word = 0; word < DISPLAY_QUEUE_DEVICE_WORDS; word++){
+            uint32_t bits = dirty->devices[field][word];
+
+            while(bits != 0){
+                uint32_t device = word * 32 + __builtin_ctz(bits);
+                state->devices[field][device] = pendingState.devices[field][device];
+                bits &= bits - 1;
+            }
+        }
+    }
+
+    taskEXIT_CRITICAL();
+
+    count_latency(postTick);
+
+    return true;
+}
+
+/****************************
+ *   LOGS
+ ****************************/
+/*
+ * Bounded lock-free multi-producer single-consumer queue (bounded MPMC queue of D. Vyukov,
+ * with a single consumer). A producer claims a position with a CAS on logHead,
+ * fills the slot and publishes it by advancing the slot sequence. The display task takes
+ * the published slots in order and hands them back for the next lap.
+ * The sequence of a slot is relative to its lap (position & ~DISPLAY_QUEUE_LOG_MASK) so the
+ * zero-initialized queue is ready to use:
+ *  - lap          : free for the producer of this lap
+ *  - lap + 1      : published, to be taken by the display task
+ *  - lap + size   : taken, free for the producer of the next lap
+ * The logs are the only lossy updates: a line posted while the queue is full is dropped and counted.
+ * A line longer than DISPLAY_QUEUE_TEXT_SIZE - 1 characters is cut and counted.
+ */
+bool display_queue_post_log(const char * text, uint16_t length, bool clear)
+{
+    DisplayLogSlot_t * slot;
+    uint32_t lap;
+    uint32_t pos = logHead.load(std::memory_order_relaxed);
+
+    for(;;){
+        slot = &logQueue[pos & DISPLAY_QUEUE_LOG_MASK];
+        lap = pos & ~DISPLAY_QUEUE_LOG_MASK;
+        int32_t diff = (int32_t) (slot->sequence.load(std::memory_order_acquire) - lap);
+
+        if(diff == 0){
+            if(logHead.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+                break;
+            }
+        }
+        else if(diff < 0){
+            /* The slot of the previous lap is not taken yet: the queue is full */
+            logOverflows.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else{
+            /* Another producer took this position */
+            pos = logHead.load(std::memory_order_relaxed);
+        }
+    }
+
+    if(length > DISPLAY_QUEUE_TEXT_SIZE - 1){
+        length = DISPLAY_QUEUE_TEXT_SIZE - 1;
+        logTruncated.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    memcpy(slot->log.text, text, length);
+    slot->log.text[length] = '\0';
+    slot->log.length = length;
+    slot->log.clear = clear;
+    slot->postTick = xTaskGetTickCount();
+    slot->sequence.store(lap + 1, std::memory_order_release);
+
+    logPosted.fetch_add(1, std::memory_order_relaxed);
+    if(wakeupCb != NULL){
+        wakeupCb();
+    }
+
+    return true;
+}
+
+/* Takes the oldest log line, returns false if there is none */
+bool display_queue_take_log(DisplayLog_t * log)
+{
+    DisplayLogSlot_t * slot = &logQueue[logTail & DISPLAY_QUEUE_LOG_MASK];
+    uint32_t lap = logTail & ~DISPLAY_QUEUE_LOG_MASK;
+
+    if(slot->sequence.load(std::memory_order_acquire) != lap + 1){
+        return false;
+    }
+
+    *log = slot->log;
+    count_latency(slot->postTick);
+
+    slot->sequence.store(lap + DISPLAY_QUEUE_LOG_SIZE, std::memory_order_release);
+    logTail++;
+
+    return true;
+}
+
+void display_queue_get_stats(DisplayQueueStats_t * stats)
+{
+    taskENTER_CRITICAL();
+    stats->posted = statePosted;
+    stats->coalesced = stateCoalesced;
+    stats->rejected = stateRejected;
+    uint32_t count = latencyCount;
+    uint32_t max = latencyMax;
+    uint64_t sum = latencySum;
+    taskEXIT_CRITICAL();
+
+    stats->posted += logPosted.load(std::memory_order_relaxed);
+    stats->overflows = logOverflows.load(std::memory_order_relaxed);
+    stats->truncated = logTruncated.load(std::memory_order_relaxed);
+    stats->maxLatencyMs = max * portTICK_PERIOD_MS;
+    stats->avgLatencyMs = (count != 0) ? (uint32_t) ((sum * portTICK_PERIOD_MS) / count) : 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/* In the critical section */
+static void state_mark_dirty(uint32_t * dirtyWord, uint32_t bit)
+{
+    if(*dirtyWord & (1U << bit)){
+        stateCoalesced++;
+    }
+    *dirtyWord |= 1U << bit;
+    statePosted++;
+}
+
+/* Leaves the critical section of a state update, wakes the display task up on the first update it didn't take */
+static void state_posted(void)
+{
+    bool wakeup = !pendingAny;
+
+    if(wakeup){
+        pendingAny = true;
+        pendingTick = xTaskGetTickCount();
+    }
+
+    taskEXIT_CRITICAL();
+
+    if(wakeup && (wakeupCb != NULL)){
+        wakeupCb();
+    }
+}
+
+static void count_latency(TickType_t postTick)
+{
+    uint32_t latency = xTaskGetTickCount() - postTick;
+
+    taskENTER_CRITICAL();
+    latencySum += latency;
+    if(latency > latencyMax){
+        latencyMax = latency;
+    }
+    latencyCount++;
+    taskEXIT_CRITICAL();
+}
@@ -0,0 +1,50 @@
+#ifndef DEVICES_LIST_H_
+#define DEVICES_LIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+/*********************
+ *      DEFINES
+ *********************/
+#define DEVICES_LIST_COLS         4
+#define DEVICES_ROW_HEIGHT        30
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* What the Devices tab shows for a device, the texts are constants */
+typedef struct {
+	const char * network;
+	const char * status;
+	const char * cluster;
+} DeviceRow_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+/* Create the header and the list of the Devices tab, there is only one list. It shows `rows`,
+ * the model of `rowCount` devices kept by the caller. The list is scrolled by LVGL,
+ * so `rowCount * DEVICES_ROW_HEIGHT` must be below LV_COORD_MAX */
+void devices_list_create(lv_obj_t * parent, DeviceRow_t * rows, uint32_t rowCount);
+/* Show a binding table of `total` devices, bit i of `isOnOff` is set if the device i is an on/off light.
+ * Returns the number of devices shown, the devices beyond `rowCount` aren't */
+uint32_t devices_list_set_table(uint16_t total, const uint32_t * isOnOff);
+void devices_list_set_status(uint16_t device, const char * status);
+void devices_list_set_network(uint16_t device, const char * network);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DEVICES_LIST_H_ */
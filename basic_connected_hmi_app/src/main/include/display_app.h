@@ -19,6 +19,8 @@ extern "C" {
 /*********************
  *      DEFINES
  *********************/
+/* Slab size classes of DisplayMemStats_t, at least LV_MEM_SLAB_CLASS_CNT */
+#define DISPLAY_MEM_SLAB_CLASSES    16
 
 /**********************
  *      TYPEDEFS
@@ -43,26 +45,85 @@ typedef enum {
 	bt_start_adv,
 	bt_stop_adv,
 } BluetoothState_t;
+
+typedef struct {
+	uint32_t posted;
+	uint32_t coalesced;     /* State updates replacing a value not shown yet */
+	uint32_t rejected;      /* Updates of devices beyond DISPLAY_QUEUE_DEVICES */
+	uint32_t overflows;     /* Log lines dropped because the log queue was full */
+	uint32_t truncated;     /* Log lines cut to DISPLAY_QUEUE_TEXT_SIZE - 1 characters */
+	uint32_t maxLatencyMs;
+	uint32_t avgLatencyMs;
+} DisplayQueueStats_t;
+
+/* Values shown by the UI, an update is applied only when it changes the shown value */
+typedef enum {
+	kDisplayField_Date,
+	kDisplayField_Time,
+	kDisplayField_NetworkState,
+	kDisplayField_ThreadState,
+	kDisplayField_BluetoothState,
+	kDisplayField_OnOffState,
+	kDisplayField_MatterChannel,
+	kDisplayField_MatterPanID,
+	kDisplayField_MatterNetworkName,
+	kDisplayField_MatterIPV6Addr,
+	kDisplayField_Count,
+} DisplayField_t;
+
+typedef struct {
+	uint32_t applied;
+	uint32_t skipped;
+} DisplayFieldStats_t;
+
+/* Occupancy of a slab size class of the LVGL heap */
+typedef struct {
+	uint16_t blockSize;
+	uint16_t pageCnt;
+	uint16_t usedCnt;
+	uint16_t freeCnt;
+} DisplaySlabClassStats_t;
+
+/* LVGL heap usage copied by the display task, the other tasks must not walk the heap */
+typedef struct {
+	uint32_t sequence;      /* Snapshots taken since start-up, 0: none yet */
+	uint32_t totalSize;
+	uint32_t freeSize;
+	uint8_t fragPct;
+	uint32_t slabSize;
+	uint32_t slabUsed;
+	uint8_t slabFragPct;
+	uint32_t slabFallbacks; /* Small allocations served by the heap because the slabs were full */
+	uint8_t slabClassCnt;
+	DisplaySlabClassStats_t slabClasses[DISPLAY_MEM_SLAB_CLASSES];
+} DisplayMemStats_t;
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 void display_task(void *pvParameters);
 void lv_start_display(void);
 void updateButtons(uint8_t count);
-void updateTable(uint8_t count);
-void updateNetworkType(uint8_t device, uint8_t state);
-void updateConnectionStatus(uint8_t device, bool isConnected);
+void updateTable(uint16_t count);
+void updateNetworkType(uint16_t device, uint8_t state);
+void updateConnectionStatus(uint16_t device, bool isConnected);
 void updateDate(uint16_t year, uint8_t month, uint8_t day);
 void updateTime(uint8_t hour, uint8_t minutes, uint8_t am_pm);
 void updateNetworkState(NetworkSate_t state);
 void updateThreadState(ThreadRole_t role);
 void updateBluetoothState(BluetoothState_t state);
-void updateOnOffState(bool state, uint8_t device);
+void updateOnOffState(bool state, uint16_t device);
 void updateMatterChannel(uint16_t channel);
 void updateMatterPanID(uint16_t panId);
 void updateMatterNetworkName(char * name);
 void updateMatterIPV6Addr(uint16_t * addr);
 void addMatterLogs(char * textLogs, uint16_t length, bool clear);
+uint32_t getDisplayWakeupsPerSecond(void);
+uint32_t getAnimRefreshesPerSecond(void);
+void getDisplayQueueStats(DisplayQueueStats_t * stats);
+const char * getDisplayFieldStats(DisplayField_t field, DisplayFieldStats_t * stats);
+void requestGpuCalibration(void);
+void requestMemStats(void);
+void getMemStats(DisplayMemStats_t * stats);
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,128 @@
+#ifndef DISPLAY_QUEUE_H_
+#define DISPLAY_QUEUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "display_app.h"
+/*********************
+ *      DEFINES
+ *********************/
+#define DISPLAY_QUEUE_TEXT_SIZE     100
+/* Log lines which can wait for the display task, must be a power of 2 */
+#define DISPLAY_QUEUE_LOG_SIZE      32
+/* Devices whose state can be posted, for the on/off cards and the rows of the devices list */
+#ifndef DISPLAY_QUEUE_DEVICES
+#define DISPLAY_QUEUE_DEVICES       256
+#endif
+#define DISPLAY_QUEUE_DEVICE_WORDS  ((DISPLAY_QUEUE_DEVICES + 31) / 32)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* Fields of the display state, the bits of DisplayStateDirty_t.fields */
+typedef enum {
+	kDisplayState_Date,
+	kDisplayState_Time,
+	kDisplayState_NetworkState,
+	kDisplayState_ThreadState,
+	kDisplayState_BluetoothState,
+	kDisplayState_MatterChannel,
+	kDisplayState_MatterPanID,
+	kDisplayState_MatterNetworkName,
+	kDisplayState_MatterIPV6Addr,
+	kDisplayState_Buttons,
+	kDisplayState_Table,
+	kDisplayState_GpuCalibrate,
+	kDisplayState_MemStats,
+	kDisplayState_Count,
+} DisplayStateField_t;
+
+/* Fields of each device */
+typedef enum {
+	kDisplayDevice_OnOff,
+	kDisplayDevice_Connection,
+	kDisplayDevice_NetworkType,
+	kDisplayDevice_Count,
+} DisplayDeviceField_t;
+
+/* What the display shows. The producers overwrite the fields, the latest value wins */
+typedef struct {
+	struct {
+		uint16_t year;
+		uint8_t month;
+		uint8_t day;
+	} date;
+	struct {
+		uint8_t hour;
+		uint8_t minutes;
+		uint8_t am_pm;
+	} time;
+	NetworkSate_t networkState;
+	ThreadRole_t threadRole;
+	BluetoothState_t bluetoothState;
+	uint16_t matterChannel;
+	uint16_t matterPanId;
+	char matterNetworkName[DISPLAY_QUEUE_TEXT_SIZE];
+	uint16_t matterIpv6Addr[8];
+	uint8_t buttons;
+	/* Binding table of `total` devices, bit i of `onOff` is set if the device i is an on/off light */
+	struct {
+		uint16_t total;
+		uint32_t onOff[DISPLAY_QUEUE_DEVICE_WORDS];
+	} table;
+	uint8_t devices[kDisplayDevice_Count][DISPLAY_QUEUE_DEVICES];
+} DisplayState_t;
+
+/* Fields changed since the display task took the state */
+typedef struct {
+	uint32_t fields;
+	uint32_t devices[kDisplayDevice_Count][DISPLAY_QUEUE_DEVICE_WORDS];
+} DisplayStateDirty_t;
+
+/* A log line, `text` is terminated */
+typedef struct {
+	uint16_t length;
+	bool clear;
+	char text[DISPLAY_QUEUE_TEXT_SIZE];
+} DisplayLog_t;
+
+/* Called when an update is posted while the display task may be waiting */
+typedef void (*display_queue_wakeup_cb_t)(void);
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+void display_queue_set_wakeup_cb(display_queue_wakeup_cb_t cb);
+
+/* Producers, any task. Between lock and unlock the state can be written,
+ * the interrupts are disabled so only copy the new value of the field */
+DisplayState_t * display_queue_lock(void);
+void display_queue_unlock(DisplayStateField_t field);
+bool display_queue_post_device(DisplayDeviceField_t field, uint16_t device, uint8_t value);
+bool display_queue_post_log(const char * text, uint16_t length, bool clear);
+
+/* Consumer, the display task only */
+bool display_queue_take_state(DisplayState_t * state, DisplayStateDirty_t * dirty);
+bool display_queue_take_log(DisplayLog_t * log);
+
+void display_queue_get_stats(DisplayQueueStats_t * stats);
+/**********************
+ *      MACROS
+ **********************/
+#define DISPLAY_QUEUE_DEVICE_DIRTY(dirty, field, device) \
+	(((dirty)->devices[field][(device) / 32] >> ((device) % 32)) & 1U)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DISPLAY_QUEUE_H_ */
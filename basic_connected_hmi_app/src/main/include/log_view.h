@@ -0,0 +1,40 @@
+#ifndef LOG_VIEW_H_
+#define LOG_VIEW_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+/*********************
+ *      DEFINES
+ *********************/
+/* Lines of Matter logs kept by the Connectivity tab, must be a power of 2.
+ * The history is a static array, so it's in the SDRAM with the rest of .bss (see rt_hmi.ld) */
+#ifndef LOG_HISTORY_LINES
+#define LOG_HISTORY_LINES     2048
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+/* Create the log view, there is only one. Its font and width are taken from its styles */
+lv_obj_t * log_view_create(lv_obj_t * parent);
+/* Add a line below the others, dropping the oldest one if the history is full */
+void log_view_add(const char * text, uint16_t length);
+/* Remove all the lines */
+void log_view_clear(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LOG_VIEW_H_ */
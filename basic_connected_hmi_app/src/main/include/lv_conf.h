@@ -54,7 +54,8 @@
 #define LV_MEM_CUSTOM 0
 #if LV_MEM_CUSTOM == 0
 /* Size of the memory used by `lv_mem_alloc` in bytes (>= 2kB)*/
-#  define LV_MEM_SIZE    (64U * 1024U)
+#  define LV_MEM_SIZE    (64U * 1024U + LV_IMG_CACHE_DEF_BUDGET + LV_GLYPH_CACHE_BUDGET + \
+                          LV_SHADOW_CACHE_BUDGET + LV_CIRCLE_CACHE_BUDGET)
 
 /* Set an address for the memory pool instead of allocating it as an array.
  * Can be in external SRAM too. */
@@ -66,6 +67,20 @@
 #  define LV_MEM_CUSTOM_FREE    vPortFree      /*Wrapper to free*/
 #endif     /*LV_MEM_CUSTOM*/
 
+/* Size of a region serving the allocations up to LV_MEM_SLAB_MAX_SIZE bytes (objects, style and event lists)
+ * from pages of equally sized blocks, so creating and deleting widgets doesn't fragment the heap.
+ * The heap is used when it's full. 0: allocate everything from the heap */
+#define LV_MEM_SLAB_SIZE    (32U * 1024U)
+
+/* Largest allocation served from the slabs, with a size class for every 8 bytes.
+ * Covers `lv_obj_t`, `lv_label_t`, `lv_img_t`, `lv_table_t` and `lv_anim_t`. */
+#define LV_MEM_SLAB_MAX_SIZE    72
+
+/* Size of a fixed region serving the temporal buffers of the drawing (`lv_mem_buf_get`).
+ * It's reset after every refresh, buffers which don't fit are allocated from the heap.
+ * 0: allocate them only from the heap */
+#define LV_MEM_BUF_ARENA_SIZE    (32U * 1024U)
+
 /* Use the standard memcpy and memset instead of LVGL's own functions.
  * The standard functions might or might not be faster depending on their implementation. */
 #define LV_MEMCPY_MEMSET_STD    0
@@ -90,8 +105,19 @@
 /* Allow buffering some shadow calculation
  * LV_SHADOW_CACHE_SIZE is the max. shadow size to buffer,
  * where shadow size is `shadow_width + radius`
- * Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost*/
-#define LV_SHADOW_CACHE_SIZE    0
+ * Caching has LV_SHADOW_CACHE_SIZE^2 RAM cost per cached shadow*/
+#define LV_SHADOW_CACHE_SIZE    64
+
+/* Bytes of blurred shadow corners to keep, shared by the same sized cards.
+ * The corners come from the LVGL heap, LV_MEM_SIZE is grown by this amount */
+#define LV_SHADOW_CACHE_BUDGET  (16U * 1024U)
+
+/* Number of circle coverage tables for the rounded corners of cards and buttons.
+ * A table of radius r costs about r * (r + 9) bytes */
+#define LV_CIRCLE_CACHE_SIZE    8
+
+/* Bytes of circle coverage tables to keep. The tables come from the LVGL heap, LV_MEM_SIZE is grown by this amount */
+#define LV_CIRCLE_CACHE_BUDGET  (8U * 1024U)
 #endif
 
 /* 1: Enable GPU interface*/
@@ -130,7 +156,24 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
  * With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  * However the opened images might consume additional RAM.
  * Set it to 0 to disable caching */
-#define LV_IMG_CACHE_DEF_SIZE 1
+#define LV_IMG_CACHE_DEF_SIZE 32
+
+/* Bytes of decoded pixels the image cache keeps resident (e.g. alpha icons decoded per recolor).
+ * Recolored icons are kept too, one buffer per (icon, color), and the zoomed copies of the QR codes.
+ * The buffers come from the LVGL heap, LV_MEM_SIZE is grown by this amount. 0: don't keep them */
+#define LV_IMG_CACHE_DEF_BUDGET (256U * 1024U)
+
+/* Number of glyphs kept as ready to blend 8 bit coverage maps, e.g. the letters of
+ * the status labels and table headers which are redrawn all the time. 0: to disable caching */
+#define LV_GLYPH_CACHE_SIZE 256
+
+/* Bytes of glyph coverage maps to keep. The maps come from the LVGL heap, LV_MEM_SIZE is grown by this amount */
+#define LV_GLYPH_CACHE_BUDGET (32U * 1024U)
+
+/* Number of resolved style properties to remember, e.g. the paddings, colors and radii
+ * queried again and again while the cards and rows are laid out and drawn.
+ * Takes 20 bytes per entry. Must be a power of 2, at least 2. 0: to disable caching */
+#define LV_STYLE_CACHE_SIZE 2048
 
 /* Maximum buffer size to allocate for rotation. Only used if software rotation is enabled in the display driver. */
 #define LV_DISP_ROT_MAX_BUF (10*1024)
@@ -187,6 +230,10 @@ e.g. "stm32f769xx.h" or "stm32f429xx.h" */
  * placed in RAM sections that are DMA accessible */
 #define LV_ATTRIBUTE_DMA
 
+/* Place the LV_MEM_BUF_ARENA_SIZE region into the on-chip OCRAM instead of the SDRAM (see rt_hmi.ld).
+ * PXP reads these buffers too, so it's not in the DTCM. */
+#define LV_ATTRIBUTE_MEM_BUF_ARENA __attribute__((section(".lvgl_mem_buf_arena"), aligned(LV_ATTRIBUTE_MEM_ALIGN_SIZE)))
+
 /*===================
  *  HAL settings
  *==================*/
@@ -0,0 +1,267 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "log_view.h"
+#include "display_queue.h"
+#include <string.h>
+
+#ifdef DISPLAY_MATTER_LOGS
+/*********************
+ *      DEFINES
+ *********************/
+#define LOG_HISTORY_MASK      (LOG_HISTORY_LINES - 1)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/* A line of the log view, wrapped to `rows` rows of text.
+ * `firstRow` only grows, so dropping the oldest line doesn't renumber the others */
+typedef struct {
+    uint32_t firstRow;
+    uint8_t rows;
+    uint8_t length;
+    char text[DISPLAY_QUEUE_TEXT_SIZE];
+} LogLine_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void log_view_event_cb(lv_event_t * e);
+static void log_view_wrap(LogLine_t * line, uint32_t firstRow);
+static void log_view_rewrap(void);
+static void log_view_draw(const lv_area_t * clipArea);
+static uint32_t log_view_get_rows(void);
+static uint32_t log_view_get_top(void);
+static uint32_t log_view_find_line(uint32_t row);
+static lv_coord_t log_view_get_row_height(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/* The log view draws only the visible lines of `logLines`, a ring buffer indexed by
+ * sequence numbers from `logFirst` (oldest line) to `logNext` (next line to add) */
+static lv_obj_t * logView;
+static LogLine_t logLines[LOG_HISTORY_LINES];
+static uint32_t logFirst;
+static uint32_t logNext;
+static lv_coord_t logWrapWidth;
+/* Distance of the visible rows from the newest ones in pixels, 0: follow the new lines.
+ * The history is taller than what lv_coord_t can scroll, so the view scrolls itself */
+static uint32_t logScrollFromBottom;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+lv_obj_t * log_view_create(lv_obj_t * parent)
+{
+    logView = lv_obj_create(parent);
+    lv_obj_clear_flag(logView, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(logView, log_view_event_cb, LV_EVENT_ALL, NULL);
+    return logView;
+}
+
+void log_view_add(const char * text, uint16_t length)
+{
+    uint32_t firstRow = 0;
+    if(logNext != logFirst){
+        LogLine_t * last = &logLines[(logNext - 1) & LOG_HISTORY_MASK];
+        firstRow = last->firstRow + last->rows;
+    }
+
+    /* Drop the oldest line if the history is full, it's the slot of the new one */
+    if(logNext - logFirst == LOG_HISTORY_LINES){
+        logFirst++;
+    }
+
+    LogLine_t * line = &logLines[logNext & LOG_HISTORY_MASK];
+    if(length >= sizeof(line->text)){
+        length = sizeof(line->text) - 1;
+    }
+    memcpy(line->text, text, length);
+    line->text[length] = '\0';
+    line->length = length;
+    log_view_wrap(line, firstRow);
+    logNext++;
+
+    /* Keep the rows in place if older lines are being read */
+    if(logScrollFromBottom != 0){
+        logScrollFromBottom += line->rows * log_view_get_row_height();
+    }
+
+    lv_obj_invalidate(logView);
+}
+
+void log_view_clear(void)
+{
+    logFirst = logNext;
+    logScrollFromBottom = 0;
+    lv_obj_invalidate(logView);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+static void log_view_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if(code == LV_EVENT_DRAW_MAIN){
+        log_view_draw((const lv_area_t *) lv_event_get_param(e));
+    }
+    else if(code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED){
+        log_view_rewrap();
+    }
+    else if(code == LV_EVENT_PRESSING){
+        /* Drag the rows, unless a parent (e.g. the tabview) is being scrolled */
+        lv_indev_t * indev = lv_indev_get_act();
+        if(indev == NULL || lv_indev_get_scroll_obj(indev) != NULL){
+            return;
+        }
+
+        lv_point_t vect;
+        lv_indev_get_vect(indev, &vect);
+        if(vect.y == 0){
+            return;
+        }
+
+        uint32_t maxScroll = log_view_get_rows() * log_view_get_row_height();
+        lv_coord_t viewHeight = lv_obj_get_content_height(logView);
+        maxScroll = (maxScroll > (uint32_t) viewHeight) ? maxScroll - viewHeight : 0;
+
+        int32_t scroll = (int32_t) logScrollFromBottom + vect.y;
+        logScrollFromBottom = LV_MIN((uint32_t) LV_MAX(scroll, 0), maxScroll);
+        lv_obj_invalidate(logView);
+    }
+}
+
+/* Count the rows of a line wrapped like `lv_draw_label` wraps it in the log view */
+static void log_view_wrap(LogLine_t * line, uint32_t firstRow)
+{
+    const lv_font_t * font = lv_obj_get_style_text_font(logView, LV_PART_MAIN);
+    lv_coord_t letterSpace = lv_obj_get_style_text_letter_space(logView, LV_PART_MAIN);
+    const char * txt = line->text;
+
+    line->firstRow = firstRow;
+    line->rows = 0;
+    do {
+        txt += _lv_txt_get_next_line(txt, font, letterSpace, logWrapWidth, LV_TEXT_FLAG_NONE);
+        line->rows++;
+    } while(*txt != '\0');
+}
+
+/* The width or the font changed, wrap the whole history again */
+static void log_view_rewrap(void)
+{
+    logWrapWidth = lv_obj_get_content_width(logView);
+    uint32_t firstRow = 0;
+    for(uint32_t i = logFirst; i != logNext; i++){
+        LogLine_t * line = &logLines[i & LOG_HISTORY_MASK];
+        log_view_wrap(line, firstRow);
+        firstRow += line->rows;
+    }
+    logScrollFromBottom = 0;
+    lv_obj_invalidate(logView);
+}
+
+static void log_view_draw(const lv_area_t * clipArea)
+{
+    lv_area_t content;
+    lv_area_t clip;
+    lv_obj_get_content_coords(logView, &content);
+    if(logNext == logFirst || !_lv_area_intersect(&clip, clipArea, &content)){
+        return;
+    }
+
+    lv_coord_t rowHeight = log_view_get_row_height();
+    uint32_t top = log_view_get_top();
+    uint32_t baseRow = logLines[logFirst & LOG_HISTORY_MASK].firstRow;
+
+    lv_draw_label_dsc_t labelDsc;
+    lv_draw_label_dsc_init(&labelDsc);
+    lv_obj_init_draw_label_dsc(logView, LV_PART_MAIN, &labelDsc);
+
+    /* Start with the line of the first row in the clip area and stop below it */
+    uint32_t row = (top + (clip.y1 - content.y1)) / rowHeight;
+    for(uint32_t i = log_view_find_line(row); i != logNext; i++){
+        LogLine_t * line = &logLines[i & LOG_HISTORY_MASK];
+        lv_area_t lineArea;
+        lineArea.x1 = content.x1;
+        lineArea.x2 = content.x2;
+        lineArea.y1 = content.y1 + (lv_coord_t) ((int32_t) ((line->firstRow - baseRow) * rowHeight) - (int32_t) top);
+        if(lineArea.y1 > clip.y2){
+            break;
+        }
+        lineArea.y2 = lineArea.y1 + line->rows * rowHeight - 1;
+        lv_draw_label(&lineArea, &clip, &labelDsc, line->text, NULL);
+    }
+
+    /* Scrollbar, drawn like LVGL draws it for the scrollable objects */
+    uint32_t totalHeight = log_view_get_rows() * rowHeight;
+    lv_coord_t viewHeight = lv_area_get_height(&content);
+    if(totalHeight > (uint32_t) viewHeight){
+        lv_draw_rect_dsc_t rectDsc;
+        lv_draw_rect_dsc_init(&rectDsc);
+        lv_obj_init_draw_rect_dsc(logView, LV_PART_SCROLLBAR, &rectDsc);
+
+        lv_coord_t width = lv_obj_get_style_width(logView, LV_PART_SCROLLBAR);
+        lv_coord_t thumbHeight = LV_MAX((lv_coord_t) (((uint64_t) viewHeight * viewHeight) / totalHeight), 2 * width);
+        lv_area_t thumb;
+        thumb.x2 = logView->coords.x2 - lv_obj_get_style_pad_right(logView, LV_PART_SCROLLBAR);
+        thumb.x1 = thumb.x2 - width + 1;
+        thumb.y1 = content.y1 + (lv_coord_t) (((uint64_t) (viewHeight - thumbHeight) * top) / (totalHeight - viewHeight));
+        thumb.y2 = thumb.y1 + thumbHeight - 1;
+        lv_draw_rect(&thumb, clipArea, &rectDsc);
+    }
+}
+
+static uint32_t log_view_get_rows(void)
+{
+    if(logNext == logFirst){
+        return 0;
+    }
+
+    LogLine_t * first = &logLines[logFirst & LOG_HISTORY_MASK];
+    LogLine_t * last = &logLines[(logNext - 1) & LOG_HISTORY_MASK];
+    return last->firstRow + last->rows - first->firstRow;
+}
+
+/* Offset of the top of the view from the first row in pixels */
+static uint32_t log_view_get_top(void)
+{
+    uint32_t totalHeight = log_view_get_rows() * log_view_get_row_height();
+    uint32_t viewHeight = lv_obj_get_content_height(logView);
+    if(totalHeight <= viewHeight + logScrollFromBottom){
+        return 0;
+    }
+
+    return totalHeight - viewHeight - logScrollFromBottom;
+}
+
+/* Binary search for the sequence number of the line containing a row, counted from the first row */
+static uint32_t log_view_find_line(uint32_t row)
+{
+    uint32_t baseRow = logLines[logFirst & LOG_HISTORY_MASK].firstRow;
+    uint32_t low = 0;
+    uint32_t high = logNext - logFirst - 1;
+
+    while(low < high){
+        uint32_t mid = low + (high - low + 1) / 2;
+        if(logLines[(logFirst + mid) & LOG_HISTORY_MASK].firstRow - baseRow <= row){
+            low = mid;
+        } else{
+            high = mid - 1;
+        }
+    }
+
+    return logFirst + low;
+}
+
+static lv_coord_t log_view_get_row_height(void)
+{
+    const lv_font_t * font = lv_obj_get_style_text_font(logView, LV_PART_MAIN);
+    return lv_font_get_line_height(font) + lv_obj_get_style_text_line_space(logView, LV_PART_MAIN);
+}
+#endif /* DISPLAY_MATTER_LOGS */
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_blend.c
+ * Throughput of the normal blending of RGB565 pixels one by one and in pairs.
+ * The pairs with an opacity are mixed with plain multiplications, so their host figures are meaningful.
+ * The masked pairs use SMLAD, which is emulated on the host (see dsp/): time them on the target.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include "blend_ref.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BUF_W       LCD_WIDTH
+#define BUF_H       64
+#define ITER_CNT    200
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    BENCH_MAP_OPA,
+    BENCH_MAP_MASK,
+    BENCH_MAP_MASK_OPA,
+    BENCH_FILL_MASK,
+    BENCH_CNT,
+} bench_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static double measure(bench_t bench, bool ref);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_color_t map[BUF_W * BUF_H];
+static lv_opa_t mask[BUF_W * BUF_H];
+static lv_area_t area = {0, 0, BUF_W - 1, BUF_H - 1};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static const char * names[BENCH_CNT] = {"map with opa", "map with mask", "map with mask and opa",
+                                            "fill with mask"
+                                           };
+    static lv_test_disp_t disp;
+    uint32_t i;
+
+    lv_init();
+    lv_test_disp_init(&disp, true);
+
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp.disp);
+    lv_area_copy(&draw_buf->area, &area);
+    _lv_refr_set_disp_refreshing(disp.disp);
+
+    /*Anti-aliased edges: mostly opaque with some mixed pixels*/
+    for(i = 0; i < BUF_W * BUF_H; i++) {
+        map[i].full = lv_test_rand(0);
+        mask[i] = (i % 7 == 0) ? LV_OPA_COVER : (i * 37) & 0xFF;
+    }
+
+    for(i = 0; i < BENCH_CNT; i++) {
+        double ref = measure(i, true);
+        double pairs = measure(i, false);
+        printf("bench_blend: %-22s %6.1f Mpx/s one by one, %6.1f Mpx/s in pairs\n", names[i], ref, pairs);
+    }
+
+    _lv_refr_set_disp_refreshing(NULL);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static double measure(bench_t bench, bool ref)
+{
+    lv_color_t color = lv_color_hex(0x3080C0);
+    uint32_t i;
+
+    uint64_t start = lv_test_now_us();
+    for(i = 0; i < ITER_CNT; i++) {
+        switch(bench) {
+            case BENCH_MAP_OPA:
+                if(ref) blend_ref_map(&area, &area, map, NULL, LV_DRAW_MASK_RES_FULL_COVER, LV_OPA_50, LV_BLEND_MODE_NORMAL);
+                else _lv_blend_map(&area, &area, map, NULL, LV_DRAW_MASK_RES_FULL_COVER, LV_OPA_50, LV_BLEND_MODE_NORMAL);
+                break;
+            case BENCH_MAP_MASK:
+                if(ref) blend_ref_map(&area, &area, map, mask, LV_DRAW_MASK_RES_CHANGED, LV_OPA_COVER, LV_BLEND_MODE_NORMAL);
+                else _lv_blend_map(&area, &area, map, mask, LV_DRAW_MASK_RES_CHANGED, LV_OPA_COVER, LV_BLEND_MODE_NORMAL);
+                break;
+            case BENCH_MAP_MASK_OPA:
+                if(ref) blend_ref_map(&area, &area, map, mask, LV_DRAW_MASK_RES_CHANGED, LV_OPA_50, LV_BLEND_MODE_NORMAL);
+                else _lv_blend_map(&area, &area, map, mask, LV_DRAW_MASK_RES_CHANGED, LV_OPA_50, LV_BLEND_MODE_NORMAL);
+                break;
+            default:
+                if(ref) blend_ref_fill(&area, &area, color, mask, LV_DRAW_MASK_RES_CHANGED, LV_OPA_COVER,
+                                           LV_BLEND_MODE_NORMAL);
+                else _lv_blend_fill(&area, &area, color, mask, LV_DRAW_MASK_RES_CHANGED, LV_OPA_COVER, LV_BLEND_MODE_NORMAL);
+                break;
+        }
+    }
+    uint64_t us = lv_test_now_us() - start;
+
+    return (double)ITER_CNT * BUF_W * BUF_H / (us ? us : 1);
+}
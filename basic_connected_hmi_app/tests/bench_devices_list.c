@@ -0,0 +1,129 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_devices_list.c
+ * The Devices tab with a binding table of 500 devices, built as display_app.cpp does: time to show
+ * the table, the device info of every device and the same table again, and frame time while the
+ * list is scrolled to its end. The list must keep the same widgets whatever the number of devices.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include "displayResources.h"
+#include "devices_list.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define DEVICE_CNT      500
+#define SCROLL_STEP     8
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static double show_table(uint16_t total);
+static double show_device_info(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+extern lv_style_t gTabStyle;
+
+static const char * networks[] = {"Unspecified", "Wi-Fi", "Ethernet", "LTE", "Thread"};
+
+static lv_test_disp_t disp;
+static DeviceRow_t rows[DEVICE_CNT];
+static uint32_t is_on_off[(DEVICE_CNT + 31) / 32];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_mem_monitor_t start;
+    lv_mem_monitor_t mon;
+    uint32_t i;
+
+    lv_init();
+    lv_test_disp_init(&disp, false);
+    lv_initResources();
+
+    lv_obj_t * tabview = lv_tabview_create(lv_disp_get_scr_act(disp.disp), LV_DIR_BOTTOM, LCD_HEIGHT / 7);
+    lv_tabview_add_tab(tabview, "Home");
+    lv_obj_t * tab = lv_tabview_add_tab(tabview, "Devices");
+    lv_tabview_add_tab(tabview, "Info");
+    lv_tabview_add_tab(tabview, "Connectivity");
+    lv_obj_add_style(tab, &gTabStyle, LV_STATE_DEFAULT);
+    lv_obj_set_flex_flow(tab, LV_FLEX_FLOW_COLUMN);
+    lv_obj_clear_flag(tab, LV_OBJ_FLAG_SCROLLABLE);
+    devices_list_create(tab, rows, DEVICE_CNT);
+    lv_tabview_set_act(tabview, 1, LV_ANIM_OFF);
+    lv_refr_now(disp.disp);
+
+    lv_obj_t * list = lv_obj_get_child(tab, 1);
+    uint32_t widget_cnt = lv_obj_get_child_cnt(list);
+    lv_mem_monitor(&start);
+
+    for(i = 0; i < DEVICE_CNT; i++) {
+        if(i % 3) is_on_off[i / 32] |= 1U << (i % 32);
+    }
+    double table_us = show_table(DEVICE_CNT);
+    lv_mem_monitor(&mon);
+    double info_us = show_device_info();
+    double again_us = show_table(DEVICE_CNT);
+    LV_TEST_ASSERT_INT_EQ(widget_cnt, lv_obj_get_child_cnt(list));
+
+    /*Scrolled by the user to the last device*/
+    uint32_t step_cnt = 0;
+    uint64_t scroll_start = lv_test_now_us();
+    while(lv_obj_get_scroll_bottom(list) > 0) {
+        lv_obj_scroll_by(list, 0, -SCROLL_STEP, LV_ANIM_OFF);
+        lv_refr_now(disp.disp);
+        step_cnt++;
+    }
+    double frame_us = (double)(lv_test_now_us() - scroll_start) / step_cnt;
+    LV_TEST_ASSERT(step_cnt >= (DEVICE_CNT * DEVICES_ROW_HEIGHT - LCD_HEIGHT) / SCROLL_STEP);
+    LV_TEST_ASSERT_INT_EQ(widget_cnt, lv_obj_get_child_cnt(list));
+
+    /*A bigger table than the model shows only the devices of the model*/
+    LV_TEST_ASSERT_INT_EQ(DEVICE_CNT, devices_list_set_table(DEVICE_CNT + 20, is_on_off));
+
+    printf("bench_devices_list: %u devices with %u widgets (%d B of heap), table %.0f us, device info %.0f us, "
+           "same table %.0f us, scrolling %.0f us/frame\n", (unsigned)DEVICE_CNT, (unsigned)widget_cnt,
+           (int)(start.free_size - mon.free_size), table_us, info_us, again_us, frame_us);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*In us, with the refresh which shows it*/
+static double show_table(uint16_t total)
+{
+    uint64_t start = lv_test_now_us();
+    LV_TEST_ASSERT_INT_EQ(total, devices_list_set_table(total, is_on_off));
+    lv_refr_now(disp.disp);
+    return (double)(lv_test_now_us() - start);
+}
+
+/*The connection status and network type of every device, as the binding handler reads them*/
+static double show_device_info(void)
+{
+    uint16_t i;
+
+    uint64_t start = lv_test_now_us();
+    for(i = 0; i < DEVICE_CNT; i++) {
+        devices_list_set_status(i, (i % 7) ? "Connected" : "Disconnected");
+        devices_list_set_network(i, networks[i % 5]);
+    }
+    lv_refr_now(disp.disp);
+    return (double)(lv_test_now_us() - start);
+}
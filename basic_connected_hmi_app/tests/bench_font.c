@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_font.c
+ * Glyph descriptor lookups and text measurement of the built-in fonts with and without
+ * their glyph id and kerning cache. The fonts without the cache are copies of the built-in ones.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define FONT_CNT        (sizeof(fonts) / sizeof(fonts[0]))
+#define TXT_CNT         (sizeof(txts) / sizeof(txts[0]))
+#define PASS_CNT        2000
+#define KERN_PAIR_CNT   2000000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t dsc;
+} font_copy_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static const lv_font_t * copy_without_cache(const lv_font_t * font, font_copy_t * copy);
+static uint32_t glyph_dsc_pass(const lv_font_t * const * f);
+static uint32_t txt_size_pass(const lv_font_t * const * f);
+static double measure(uint32_t (*pass)(const lv_font_t * const *), const lv_font_t * const * f, uint32_t * sum);
+static uint32_t kern_pairs(const lv_font_t * font);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*The sizes enabled in lv_conf.h*/
+static const lv_font_t * fonts[] = {
+    &lv_font_montserrat_8, &lv_font_montserrat_10, &lv_font_montserrat_12, &lv_font_montserrat_14,
+    &lv_font_montserrat_16, &lv_font_montserrat_20, &lv_font_montserrat_30, &lv_font_montserrat_40,
+};
+
+/*Texts of the HMI*/
+static const char * txts[] = {
+    "CONNECTED",
+    "DISABLED",
+    "Light 1",
+    "Node ID: 0x1234  Endpoint 1",
+    "Wi-Fi " LV_SYMBOL_WIFI " " LV_SYMBOL_OK " " LV_SYMBOL_SETTINGS,
+    "The quick brown fox jumps over the lazy dog 0123456789",
+    LV_SYMBOL_HOME LV_SYMBOL_POWER LV_SYMBOL_BELL LV_SYMBOL_LIST,
+};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static font_copy_t copies[FONT_CNT];
+    static const lv_font_t * uncached[FONT_CNT];
+    uint32_t sum;
+    uint32_t sum_uncached;
+    uint32_t i;
+
+    lv_init();
+
+    for(i = 0; i < FONT_CNT; i++) uncached[i] = copy_without_cache(fonts[i], &copies[i]);
+
+    double cached_us = measure(glyph_dsc_pass, fonts, &sum);
+    double uncached_us = measure(glyph_dsc_pass, uncached, &sum_uncached);
+    LV_TEST_ASSERT_INT_EQ(sum, sum_uncached);
+    printf("bench_font: glyph descriptors     %6.2f us per pass, %6.2f us without the cache\n", cached_us,
+           uncached_us);
+
+    cached_us = measure(txt_size_pass, fonts, &sum);
+    uncached_us = measure(txt_size_pass, uncached, &sum_uncached);
+    LV_TEST_ASSERT_INT_EQ(sum, sum_uncached);
+    printf("bench_font: lv_txt_get_size       %6.2f us per pass, %6.2f us without the cache\n", cached_us,
+           uncached_us);
+
+    /*Montserrat uses kern classes: check the kern pair cache with a font using pairs*/
+    font_copy_t hebrew;
+    const lv_font_t * hebrew_uncached = copy_without_cache(&lv_font_dejavu_16_persian_hebrew, &hebrew);
+    LV_TEST_ASSERT_INT_EQ(kern_pairs(&lv_font_dejavu_16_persian_hebrew), kern_pairs(hebrew_uncached));
+    printf("bench_font: %u random kern pair lookups identical without the cache\n", (unsigned)KERN_PAIR_CNT);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static const lv_font_t * copy_without_cache(const lv_font_t * font, font_copy_t * copy)
+{
+    copy->font = *font;
+    copy->dsc = *(const lv_font_fmt_txt_dsc_t *)font->dsc;
+    copy->dsc.cache = NULL;
+    copy->font.dsc = &copy->dsc;
+    return &copy->font;
+}
+
+/*The lookups of the drawing: each letter with the next one for kerning*/
+static uint32_t glyph_dsc_pass(const lv_font_t * const * f)
+{
+    uint32_t sum = 0;
+    uint32_t i;
+    uint32_t t;
+    for(i = 0; i < FONT_CNT; i++) {
+        for(t = 0; t < TXT_CNT; t++) {
+            uint32_t ofs = 0;
+            uint32_t letter = _lv_txt_encoded_next(txts[t], &ofs);
+            while(letter) {
+                uint32_t letter_next = _lv_txt_encoded_next(txts[t], &ofs);
+                lv_font_glyph_dsc_t g;
+                if(lv_font_get_glyph_dsc(f[i], &g, letter, letter_next)) sum += g.adv_w + g.box_w;
+                letter = letter_next;
+            }
+        }
+    }
+    return sum;
+}
+
+static uint32_t txt_size_pass(const lv_font_t * const * f)
+{
+    uint32_t sum = 0;
+    uint32_t i;
+    uint32_t t;
+    for(i = 0; i < FONT_CNT; i++) {
+        for(t = 0; t < TXT_CNT; t++) {
+            lv_point_t size;
+            lv_txt_get_size(&size, txts[t], f[i], 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+            sum += size.x * 7 + size.y;
+        }
+    }
+    return sum;
+}
+
+/*Best of 5 runs, in us per pass*/
+static double measure(uint32_t (*pass)(const lv_font_t * const *), const lv_font_t * const * f, uint32_t * sum)
+{
+    double best = 0;
+    uint32_t r;
+    uint32_t i;
+    for(r = 0; r < 5; r++) {
+        uint64_t start = lv_test_now_us();
+        for(i = 0; i < PASS_CNT; i++) *sum = pass(f);
+        double us = (double)(lv_test_now_us() - start) / PASS_CNT;
+        if(r == 0 || us < best) best = us;
+    }
+    return best;
+}
+
+/*Latin and Hebrew letters followed by Latin, Hebrew or Arabic ones*/
+static uint32_t kern_pairs(const lv_font_t * font)
+{
+    uint32_t sum = 0;
+    uint32_t i;
+    lv_test_srand(1);
+    for(i = 0; i < KERN_PAIR_CNT; i++) {
+        uint32_t letter = lv_test_rand(2) ? 0x20 + lv_test_rand(95) : 0x5D0 + lv_test_rand(27);
+        uint32_t letter_next = lv_test_rand(2) ? 0x20 + lv_test_rand(95) : 0x5D0 + lv_test_rand(27);
+        if(lv_test_rand(4) == 0) letter_next = 0x600 + lv_test_rand(0x100);
+        lv_font_glyph_dsc_t g;
+        if(lv_font_get_glyph_dsc(font, &g, letter, letter_next)) sum = sum * 31 + g.adv_w + g.box_w;
+    }
+    return sum;
+}
@@ -0,0 +1,106 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_font_compr.c
+ * Frame time of labels in a compressed font, keeping the decompression buffer between refreshes
+ * and freeing it after each refresh as before. Built with the glyph cache (bench_font_compr)
+ * and without it (bench_font_compr_nocache): the two must print the same frame hash.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LABEL_CNT   30
+#define FRAME_CNT   50
+#define ROUND_CNT   4
+
+#if LV_GLYPH_CACHE_SIZE
+    #define VARIANT "glyph cache"
+#else
+    #define VARIANT "no glyph cache"
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void scene(void);
+static void free_decompr_buf(lv_disp_drv_t * drv, uint32_t time, uint32_t px);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_test_disp_t disp;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    uint64_t hash = 0;
+
+    lv_init();
+    lv_test_disp_init(&disp, true);
+    lv_obj_t * scr = lv_disp_get_scr_act(disp.disp);
+    scene();
+
+    /*Alternated, as the frame time drifts on a loaded host*/
+    double kept_us = 0;
+    double freed_us = 0;
+    uint32_t i;
+    for(i = 0; i < ROUND_CNT; i++) {
+        disp.drv.monitor_cb = NULL;
+        double us = lv_test_bench_redraw(scr, FRAME_CNT);
+        if(i == 0 || us < kept_us) kept_us = us;
+        uint64_t kept_hash = lv_test_hash(disp.shown, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t));
+
+        disp.drv.monitor_cb = free_decompr_buf;
+        us = lv_test_bench_redraw(scr, FRAME_CNT);
+        if(i == 0 || us < freed_us) freed_us = us;
+        hash = lv_test_hash(disp.shown, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t));
+        LV_TEST_ASSERT(kept_hash == hash);
+    }
+
+    printf("bench_font_compr (%s): %.1f us/frame keeping the decompression buffer, "
+           "%.1f us/frame freeing it after each refresh, frame hash %016llx\n", VARIANT, kept_us, freed_us,
+           (unsigned long long)hash);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void scene(void)
+{
+    static const char * txts[] = {"CONNECTED", "DISABLED", "Light 1", "Light 2", "Node ID", "Endpoint", "Status",
+                                  "Wi-Fi " LV_SYMBOL_WIFI, "The quick brown fox jumps 0123456789"
+                                 };
+    lv_obj_t * scr = lv_disp_get_scr_act(disp.disp);
+    uint32_t i;
+
+    lv_test_srand(1);
+    for(i = 0; i < LABEL_CNT; i++) {
+        lv_obj_t * label = lv_label_create(scr);
+        lv_label_set_text(label, txts[lv_test_rand(sizeof(txts) / sizeof(txts[0]))]);
+        lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+        lv_obj_set_style_text_color(label, lv_color_hex(lv_test_rand(0x1000000)), 0);
+        if(i % 3 == 0) lv_obj_set_style_text_opa(label, lv_test_rand(256), 0);
+        lv_obj_set_pos(label, lv_test_rand(LCD_WIDTH + 40) - 80, lv_test_rand(LCD_HEIGHT + 20) - 30);
+    }
+}
+
+/*What the refresh did after each frame*/
+static void free_decompr_buf(lv_disp_drv_t * drv, uint32_t time, uint32_t px)
+{
+    _lv_font_clean_up_fmt_txt();
+}
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_img_recolor.c
+ * Frame time of recolored ARGB icons like the ones of the status cards,
+ * with the recolored pixels baked in the image cache and mixed at each redraw.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ICON_CNT    8
+#define ICON_W      60
+#define ICON_H      50
+#define FRAME_CNT   200
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void icon_init(void);
+static double measure(lv_obj_t * scr, uint64_t * hash);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t icon_map[ICON_W * ICON_H * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static lv_img_dsc_t icon;
+static lv_test_disp_t disp;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    uint64_t baked_hash;
+    uint64_t mixed_hash;
+    uint32_t i;
+
+    lv_init();
+    lv_test_disp_init(&disp, true);
+    icon_init();
+
+    lv_obj_t * scr = lv_disp_get_scr_act(disp.disp);
+    for(i = 0; i < ICON_CNT; i++) {
+        lv_obj_t * img = lv_img_create(scr);
+        lv_img_set_src(img, &icon);
+        lv_obj_set_pos(img, 10 + (i % 4) * 115, 40 + (i / 4) * 120);
+        lv_obj_set_style_img_recolor(img, lv_palette_main(LV_PALETTE_RED + i), 0);
+        lv_obj_set_style_img_recolor_opa(img, LV_OPA_70, 0);
+    }
+
+    double baked_us = measure(scr, &baked_hash);
+
+    /*Without budget the cache can't keep a recolored copy, the pixels are mixed while drawing*/
+    lv_img_cache_set_budget(0);
+    lv_img_cache_invalidate_src(NULL);
+    double mixed_us = measure(scr, &mixed_hash);
+
+    LV_TEST_ASSERT(baked_hash == mixed_hash);
+
+    printf("bench_img_recolor: %d recolored %dx%d icons, %.1f us/frame baked, %.1f us/frame mixed\n",
+           ICON_CNT, ICON_W, ICON_H, baked_us, mixed_us);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*A gradient disc with soft edges*/
+static void icon_init(void)
+{
+    int32_t x;
+    int32_t y;
+    uint8_t * px = icon_map;
+
+    for(y = 0; y < ICON_H; y++) {
+        for(x = 0; x < ICON_W; x++) {
+            int32_t dx = x - ICON_W / 2;
+            int32_t dy = y - ICON_H / 2;
+            int32_t d = dx * dx + dy * dy;
+            lv_color_t c = lv_color_make(x * 4, y * 5, 128);
+            lv_opa_t opa = d < 20 * 20 ? LV_OPA_COVER : d < 24 * 24 ? (24 * 24 - d) * 255 / (24 * 24 - 20 * 20) : 0;
+
+            lv_memcpy_small(px, &c, sizeof(lv_color_t));
+            px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = opa;
+            px += LV_IMG_PX_SIZE_ALPHA_BYTE;
+        }
+    }
+
+    icon.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    icon.header.w = ICON_W;
+    icon.header.h = ICON_H;
+    icon.data_size = sizeof(icon_map);
+    icon.data = icon_map;
+}
+
+static double measure(lv_obj_t * scr, uint64_t * hash)
+{
+    double us = lv_test_bench_redraw(scr, FRAME_CNT);
+    *hash = lv_test_hash(disp.shown, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t));
+    return us;
+}
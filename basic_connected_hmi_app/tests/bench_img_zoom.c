@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_img_zoom.c
+ * Frame time of the two zoomed QR codes of the home tab: anti-aliased transform,
+ * nearest neighbor transform and scaled copy kept in the image cache.
+ * The scaled copy must draw the same pixels as the nearest neighbor transform.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define QR_CNT      2
+#define QR_SIZE     64
+#define QR_ZOOM     384
+#define FRAME_CNT   200
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void qr_init(void);
+static void qr_set(bool antialias, uint16_t zoom);
+static double measure(uint64_t * hash);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t qr_map[QR_SIZE * QR_SIZE * LV_IMG_PX_SIZE_ALPHA_BYTE];
+static lv_img_dsc_t qr;
+static lv_obj_t * imgs[QR_CNT];
+static lv_test_disp_t disp;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static const uint16_t zooms[] = {128, 384, 512, 640};
+    uint64_t scaled_hash;
+    uint64_t nearest_hash;
+    uint32_t i;
+
+    lv_init();
+    lv_test_disp_init(&disp, true);
+    qr_init();
+
+    for(i = 0; i < QR_CNT; i++) {
+        imgs[i] = lv_img_create(lv_disp_get_scr_act(disp.disp));
+        lv_img_set_src(imgs[i], &qr);
+        lv_obj_set_pos(imgs[i], 40 + i * 220, 40);
+    }
+
+    /*The scaled copy is drawn from the cache, without budget the transform runs at each redraw*/
+    for(i = 0; i < sizeof(zooms) / sizeof(zooms[0]); i++) {
+        qr_set(false, zooms[i]);
+        lv_img_cache_set_budget(LV_IMG_CACHE_DEF_BUDGET);
+        measure(&scaled_hash);
+        lv_img_cache_set_budget(0);
+        measure(&nearest_hash);
+        if(scaled_hash != nearest_hash) {
+            fprintf(stderr, "zoom %u: the scaled copy differs from the transform\n", zooms[i]);
+            return 1;
+        }
+    }
+
+    qr_set(true, QR_ZOOM);
+    double antialias_us = measure(&nearest_hash);
+    qr_set(false, QR_ZOOM);
+    double nearest_us = measure(&nearest_hash);
+    lv_img_cache_set_budget(LV_IMG_CACHE_DEF_BUDGET);
+    double scaled_us = measure(&scaled_hash);
+
+    printf("bench_img_zoom: %d %dx%d images at zoom %d, %.1f us/frame anti-aliased, %.1f us/frame nearest, "
+           "%.1f us/frame scaled copy\n", QR_CNT, QR_SIZE, QR_SIZE, QR_ZOOM, antialias_us, nearest_us, scaled_us);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Random black and white modules of 2x2 pixels*/
+static void qr_init(void)
+{
+    uint32_t x;
+    uint32_t y;
+    uint8_t * px = qr_map;
+
+    lv_test_srand(1);
+    for(y = 0; y < QR_SIZE; y += 2) {
+        for(x = 0; x < QR_SIZE; x += 2) {
+            lv_color_t c = lv_test_rand(2) ? lv_color_black() : lv_color_white();
+            uint32_t i;
+            for(i = 0; i < 4; i++) {
+                px = qr_map + ((y + i / 2) * QR_SIZE + x + i % 2) * LV_IMG_PX_SIZE_ALPHA_BYTE;
+                lv_memcpy_small(px, &c, sizeof(lv_color_t));
+                px[LV_IMG_PX_SIZE_ALPHA_BYTE - 1] = LV_OPA_COVER;
+            }
+        }
+    }
+
+    qr.header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    qr.header.w = QR_SIZE;
+    qr.header.h = QR_SIZE;
+    qr.data_size = sizeof(qr_map);
+    qr.data = qr_map;
+}
+
+static void qr_set(bool antialias, uint16_t zoom)
+{
+    uint32_t i;
+    for(i = 0; i < QR_CNT; i++) {
+        lv_img_set_antialias(imgs[i], antialias);
+        lv_img_set_zoom(imgs[i], zoom);
+    }
+}
+
+static double measure(uint64_t * hash)
+{
+    double us = lv_test_bench_redraw(lv_disp_get_scr_act(disp.disp), FRAME_CNT);
+    *hash = lv_test_hash(disp.shown, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t));
+    return us;
+}
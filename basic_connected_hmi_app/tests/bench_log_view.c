@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_log_view.c
+ * Matter log lines per second shown by the logs card of the Connectivity tab, built as
+ * display_app.cpp does: with the log view of log_view.cpp, and with a label as before, whose text
+ * was cut and extended for each line. Appending only, and refreshing the display after each line.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include "displayResources.h"
+#include "log_view.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LABEL_MAX_LENGTH    500
+#define TEXT_SIZE           100
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_obj_t * card_create(lv_obj_t * parent);
+static void measure(const char * name, void (*add_cb)(const char *, uint16_t), uint32_t line_cnt,
+                    uint32_t refr_line_cnt);
+static double add_lines(void (*add_cb)(const char *, uint16_t), uint32_t line_cnt, bool refr);
+static void label_add(const char * text, uint16_t length);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+extern lv_style_t gTabStyle;
+extern lv_style_t gInvisibleContainerStyle;
+extern lv_style_t gCardWidgetStyle;
+extern lv_style_t gSmallTextStyle;
+extern lv_style_t gMediumTextStyle;
+
+static const char * msgs[] = {
+    "Thread State changed (Event 0x%08X)",
+    "    - PanID = 0x%04X",
+    "Attribute Changed : Endpoint = %u, cluster = 6, attribute = 0",
+    "BLE advertising %u",
+    "Commissioning window opened for %u s, waiting for a commissioner to connect",
+};
+
+static lv_test_disp_t disp;
+static lv_obj_t * log_container;
+static lv_obj_t * log_label;
+static uint32_t msg_cnt;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+    lv_test_disp_init(&disp, false);
+    lv_initResources();
+
+    /*The label of the previous version, scrolled to its last line by its container*/
+    lv_obj_t * title = card_create(lv_disp_get_scr_act(disp.disp));
+    log_container = lv_obj_create(lv_obj_get_parent(title));
+    lv_obj_add_style(log_container, &gInvisibleContainerStyle, LV_STATE_DEFAULT);
+    lv_obj_set_size(log_container, lv_pct(100), lv_pct(80));
+    lv_obj_align_to(log_container, title, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 0);
+    log_label = lv_label_create(log_container);
+    lv_obj_set_size(log_label, lv_pct(100), LV_SIZE_CONTENT);
+    lv_obj_add_style(log_label, &gSmallTextStyle, LV_STATE_DEFAULT);
+    lv_label_set_text(log_label, "No log to show...");
+    measure("label", label_add, 2000, 500);
+    lv_obj_clean(lv_disp_get_scr_act(disp.disp));
+
+    title = card_create(lv_disp_get_scr_act(disp.disp));
+    lv_obj_t * log_view = log_view_create(lv_obj_get_parent(title));
+    lv_obj_add_style(log_view, &gInvisibleContainerStyle, LV_STATE_DEFAULT);
+    lv_obj_add_style(log_view, &gSmallTextStyle, LV_STATE_DEFAULT);
+    lv_obj_set_size(log_view, lv_pct(100), lv_pct(80));
+    lv_obj_align_to(log_view, title, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 0);
+    log_view_add("No log to show...", strlen("No log to show..."));
+    measure("log view", log_view_add, 20000, 2000);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*The Connectivity tab with the logs card, returns the title of the card*/
+static lv_obj_t * card_create(lv_obj_t * parent)
+{
+    lv_obj_t * tabview = lv_tabview_create(parent, LV_DIR_BOTTOM, LCD_HEIGHT / 7);
+    lv_obj_t * tab = lv_tabview_add_tab(tabview, "Connectivity");
+    lv_obj_add_style(tab, &gTabStyle, LV_STATE_DEFAULT);
+
+    lv_obj_t * card = lv_obj_create(tab);
+    lv_obj_set_size(card, lv_pct(49), lv_pct(79));
+    lv_obj_add_style(card, &gCardWidgetStyle, LV_STATE_DEFAULT);
+    lv_obj_align(card, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+    lv_obj_clear_flag(card, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t * title = lv_label_create(card);
+    lv_label_set_text(title, "Logs:");
+    lv_obj_add_style(title, &gMediumTextStyle, LV_STATE_DEFAULT);
+    lv_obj_align(title, LV_ALIGN_TOP_LEFT, 5, 0);
+
+    lv_refr_now(disp.disp);
+    return title;
+}
+
+static void measure(const char * name, void (*add_cb)(const char *, uint16_t), uint32_t line_cnt,
+                    uint32_t refr_line_cnt)
+{
+    double add_us = add_lines(add_cb, line_cnt, false);
+    double refr_us = add_lines(add_cb, refr_line_cnt, true);
+    printf("bench_log_view: %-8s %9.0f lines/s (%7.1f us/line) appending, %7.0f lines/s (%7.1f us/line) "
+           "refreshing after each line\n", name, 1e6 / add_us, add_us, 1e6 / refr_us, refr_us);
+}
+
+/*In us per line*/
+static double add_lines(void (*add_cb)(const char *, uint16_t), uint32_t line_cnt, bool refr)
+{
+    char text[TEXT_SIZE];
+    uint32_t i;
+
+    uint64_t start = lv_test_now_us();
+    for(i = 0; i < line_cnt; i++) {
+        uint32_t n = msg_cnt++;
+        int length = lv_snprintf(text, sizeof(text), msgs[n % (sizeof(msgs) / sizeof(msgs[0]))], (unsigned)(n * 7919));
+        add_cb(text, (uint16_t)LV_MIN(length, TEXT_SIZE - 1));
+        if(refr) lv_refr_now(disp.disp);
+    }
+
+    return (double)(lv_test_now_us() - start) / line_cnt;
+}
+
+/*What applyMatterLogs() did before the log view*/
+static void label_add(const char * text, uint16_t length)
+{
+    if(strlen(lv_label_get_text(log_label)) + length >= LABEL_MAX_LENGTH) {
+        lv_label_cut_text(log_label, 0, length + 1);
+    }
+    lv_label_ins_text(log_label, LV_LABEL_POS_LAST, "\r\n");
+    lv_label_ins_text(log_label, LV_LABEL_POS_LAST, text);
+
+    lv_coord_t scroll = lv_obj_get_scroll_bottom(log_container);
+    if(scroll > 0) lv_obj_scroll_by(log_container, 0, -scroll, LV_ANIM_OFF);
+}
@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_shadow.c
+ * Frame time of rounded rectangles with the small and large shadows of the default theme.
+ * Built with the shadow cache (bench_shadow) and without it (bench_shadow_nocache):
+ * the two must print the same frames hash.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define RECT_CNT        10
+#define CHECK_RECT_CNT  40
+#define FRAME_CNT       50
+
+#if LV_SHADOW_CACHE_SIZE
+    #define VARIANT "cache"
+#else
+    #define VARIANT "no cache"
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void scene(lv_coord_t shadow_w, lv_coord_t ofs, lv_coord_t spread, uint32_t cnt);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_test_disp_t disp;
+static lv_style_t style;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static const lv_coord_t check_widths[] = {1, 2, 5, 10, 17, 30};
+    uint64_t hash = 0;
+    uint32_t i;
+
+    lv_init();
+    lv_test_disp_init(&disp, true);
+    lv_style_init(&style);
+    lv_obj_t * scr = lv_disp_get_scr_act(disp.disp);
+
+    /*Random sizes, radii, offsets and spreads, drawn from the cache after the first frame*/
+    for(i = 0; i < sizeof(check_widths) / sizeof(check_widths[0]); i++) {
+        scene(check_widths[i], i, i % 3, CHECK_RECT_CNT);
+        lv_test_bench_redraw(scr, 2);
+        hash ^= lv_test_hash(disp.shown, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t)) * (i + 1);
+    }
+
+    /*The shadows of the default theme*/
+    scene(LV_MAX(LV_DPI_DEF / 15, 5), 0, 0, RECT_CNT);
+    double small_us = lv_test_bench_redraw(scr, FRAME_CNT);
+    scene(LV_MAX(LV_DPI_DEF / 5, 10), 0, 0, RECT_CNT);
+    double large_us = lv_test_bench_redraw(scr, FRAME_CNT);
+
+    lv_draw_shadow_cache_stats_t stats;
+    lv_draw_shadow_cache_get_stats(&stats);
+
+    printf("bench_shadow (%s): shadow_small %.1f us/frame, shadow_large %.1f us/frame, "
+           "%u hits, %u misses, %u evictions, frames hash %016llx\n", VARIANT, small_us, large_us,
+           (unsigned)stats.hits, (unsigned)stats.misses, (unsigned)stats.evictions, (unsigned long long)hash);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void scene(lv_coord_t shadow_w, lv_coord_t ofs, lv_coord_t spread, uint32_t cnt)
+{
+    lv_obj_t * scr = lv_disp_get_scr_act(disp.disp);
+    uint32_t i;
+
+    lv_obj_clean(scr);
+    lv_style_reset(&style);
+    lv_style_set_radius(&style, 8);
+    lv_style_set_bg_opa(&style, LV_OPA_COVER);
+    lv_style_set_shadow_opa(&style, LV_OPA_80);
+    lv_style_set_shadow_width(&style, shadow_w);
+    lv_style_set_shadow_ofs_x(&style, ofs);
+    lv_style_set_shadow_ofs_y(&style, ofs);
+    lv_style_set_shadow_spread(&style, spread);
+
+    lv_test_srand(1);
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_add_style(obj, &style, 0);
+        lv_obj_set_style_shadow_color(obj, lv_color_hex(lv_test_rand(0x1000000)), 0);
+        lv_obj_set_size(obj, 2 + lv_test_rand(120), 2 + lv_test_rand(120));
+        lv_obj_set_pos(obj, lv_test_rand(LCD_WIDTH) - 40, lv_test_rand(LCD_HEIGHT) - 40);
+        if(i % 5 == 0) lv_obj_set_style_radius(obj, lv_test_rand(60), 0);
+    }
+}
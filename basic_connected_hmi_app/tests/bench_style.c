@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_style.c
+ * Style property lookups per frame of the home tab, built as display_app.cpp does from the
+ * application's resources and icons. Built with the style cache (bench_style) and without it
+ * (bench_style_nocache): the two must print the same frames hash.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include "displayResources.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LIGHT_CNT   3
+#define FRAME_CNT   50
+#define RUN_CNT     7
+
+#if LV_STYLE_CACHE_SIZE
+    #define VARIANT "cache"
+#else
+    #define VARIANT "no cache"
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void home_create(lv_obj_t * parent);
+static void card_create(lv_obj_t * parent, const lv_img_dsc_t * icon, const char * name, lv_obj_t ** info_label,
+                        const char * info_txt);
+static void status_update(uint32_t i);
+static void light_toggle(uint32_t i);
+static void measure(const char * name, void (*frame_cb)(uint32_t));
+static void full_redraw(uint32_t i);
+static int us_cmp(const void * a, const void * b);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+extern const lv_img_dsc_t qrcodeIcon;
+extern const lv_img_dsc_t networkIcon;
+extern const lv_img_dsc_t threadIcon;
+extern const lv_img_dsc_t bluetoothIcon;
+extern const lv_img_dsc_t onoffIcon;
+extern lv_style_t gTabStyle;
+extern lv_style_t gInvisibleContainerStyle;
+extern lv_style_t gCardWidgetStyle;
+extern lv_style_t gCardInfoStyle;
+extern lv_style_t gSmallTextStyle;
+extern lv_style_t gMediumTextStyle;
+
+static lv_test_disp_t disp;
+static lv_obj_t * hour_label;
+static lv_obj_t * network_label;
+static lv_obj_t * light_cards[LIGHT_CNT];
+static uint64_t hash;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+    lv_test_disp_init(&disp, false);
+    lv_initResources();
+
+    lv_obj_t * tabview = lv_tabview_create(lv_disp_get_scr_act(disp.disp), LV_DIR_BOTTOM, LCD_HEIGHT / 7);
+    lv_obj_t * home = lv_tabview_add_tab(tabview, "Home");
+    lv_tabview_add_tab(tabview, "Devices");
+    lv_tabview_add_tab(tabview, "Info");
+    lv_tabview_add_tab(tabview, "Connectivity");
+    lv_obj_set_style_bg_color(tabview, lv_palette_lighten(LV_PALETTE_GREY, 2), LV_STATE_DEFAULT);
+    lv_obj_t * tab_btns = lv_tabview_get_tab_btns(tabview);
+    lv_obj_set_style_bg_color(tab_btns, lv_palette_darken(LV_PALETTE_GREY, 2), LV_STATE_DEFAULT);
+    lv_obj_set_style_text_color(tab_btns, lv_palette_lighten(LV_PALETTE_GREY, 5), LV_STATE_DEFAULT);
+    home_create(home);
+    lv_refr_now(disp.disp);
+
+    measure("full redraw", full_redraw);
+    measure("status update", status_update);
+    measure("toggle light", light_toggle);
+
+    printf("bench_style (%s): frames hash %016llx\n", VARIANT, (unsigned long long)hash);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*The home tab of display_app.cpp*/
+static void home_create(lv_obj_t * parent)
+{
+    static lv_coord_t col_dsc[] = {LCD_WIDTH / 3 - 5, LCD_WIDTH / 3 - 5, LCD_WIDTH / 3 - 5, LV_GRID_TEMPLATE_LAST};
+    static lv_coord_t row_dsc[] = {3 * LCD_HEIGHT / 7 - 5, 3 * LCD_HEIGHT / 7 - 5, LV_GRID_TEMPLATE_LAST};
+    static const char * state_names[] = {"NETWORK", "ROLE", "STATE"};
+    static const char * state_txts[] = {"UNKNOWN", "DISABLED", "DISCONNECTED"};
+    const lv_img_dsc_t * state_icons[] = {&networkIcon, &threadIcon, &bluetoothIcon};
+    uint32_t i;
+
+    lv_obj_set_grid_dsc_array(parent, col_dsc, row_dsc);
+    lv_obj_add_style(parent, &gTabStyle, LV_STATE_DEFAULT);
+
+    lv_obj_t * left_panel = lv_obj_create(parent);
+    lv_obj_set_size(left_panel, lv_pct(33), lv_pct(100));
+    lv_obj_set_grid_cell(left_panel, LV_GRID_ALIGN_START, 0, 0, LV_GRID_ALIGN_START, 0, 1);
+    lv_obj_add_style(left_panel, &gInvisibleContainerStyle, LV_STATE_DEFAULT);
+
+    lv_obj_t * date_label = lv_label_create(left_panel);
+    lv_obj_set_size(date_label, lv_pct(100) - 10, LV_SIZE_CONTENT);
+    lv_obj_align(date_label, LV_ALIGN_TOP_LEFT, 10, 10);
+    lv_obj_add_style(date_label, &gSmallTextStyle, LV_STATE_DEFAULT);
+    lv_label_set_text(date_label, "2023/05/03");
+
+    lv_obj_t * hour_cont = lv_obj_create(left_panel);
+    lv_obj_set_size(hour_cont, lv_pct(100) - 10, LV_SIZE_CONTENT);
+    lv_obj_align_to(hour_cont, date_label, LV_ALIGN_OUT_BOTTOM_LEFT, 0, -5);
+    lv_obj_add_style(hour_cont, &gInvisibleContainerStyle, LV_STATE_DEFAULT);
+    hour_label = lv_label_create(hour_cont);
+    lv_obj_align(hour_label, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_obj_add_style(hour_label, &gMediumTextStyle, LV_STATE_DEFAULT);
+    lv_label_set_text(hour_label, "09:43");
+    lv_obj_t * am_pm_label = lv_label_create(hour_cont);
+    lv_obj_add_style(am_pm_label, &gSmallTextStyle, LV_STATE_DEFAULT);
+    lv_obj_align_to(am_pm_label, hour_label, LV_ALIGN_OUT_RIGHT_BOTTOM, 0, -5);
+    lv_label_set_text(am_pm_label, "PM");
+
+    lv_obj_t * qr_img = lv_img_create(left_panel);
+    lv_img_set_src(qr_img, &qrcodeIcon);
+    lv_img_set_zoom(qr_img, 384);
+    lv_img_set_antialias(qr_img, false);
+    lv_obj_align(qr_img, LV_ALIGN_BOTTOM_MID, 0, -20);
+    lv_obj_t * qr_label = lv_label_create(left_panel);
+    lv_obj_add_style(qr_label, &gSmallTextStyle, LV_STATE_DEFAULT);
+    lv_label_set_text(qr_label, "Scan for pairing    :");
+    lv_obj_align_to(qr_label, qr_img, LV_ALIGN_OUT_TOP_MID, 0, -25);
+
+    lv_obj_t * state_panel = lv_obj_create(parent);
+    lv_obj_set_size(state_panel, lv_pct(67), lv_pct(50));
+    lv_obj_set_grid_cell(state_panel, LV_GRID_ALIGN_START, 1, 1, LV_GRID_ALIGN_START, 0, 1);
+    lv_obj_add_style(state_panel, &gTabStyle, LV_STATE_DEFAULT);
+    lv_obj_t * prev = NULL;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * card = lv_obj_create(state_panel);
+        lv_obj_set_size(card, lv_pct(33) - 2, lv_pct(100));
+        lv_obj_add_style(card, &gCardInfoStyle, LV_STATE_DEFAULT);
+        if(prev) lv_obj_align_to(card, prev, LV_ALIGN_OUT_RIGHT_MID, 9, 0);
+        else lv_obj_align(card, LV_ALIGN_LEFT_MID, 0, 0);
+        lv_obj_t * info_label;
+        card_create(card, state_icons[i], state_names[i], &info_label, state_txts[i]);
+        lv_obj_set_style_text_font(info_label, &lv_font_montserrat_10, LV_PART_MAIN);
+        if(i == 0) network_label = info_label;
+        prev = card;
+    }
+
+    lv_obj_t * btn_panel = lv_obj_create(parent);
+    lv_obj_set_size(btn_panel, lv_pct(67), lv_pct(50));
+    lv_obj_set_grid_cell(btn_panel, LV_GRID_ALIGN_START, 1, 1, LV_GRID_ALIGN_START, 1, 1);
+    lv_obj_add_style(btn_panel, &gTabStyle, LV_STATE_DEFAULT);
+    for(i = 0; i < LIGHT_CNT; i++) {
+        char name[16];
+        lv_obj_t * info_label;
+        light_cards[i] = lv_btn_create(btn_panel);
+        lv_obj_set_size(light_cards[i], lv_pct(33) - 2, lv_pct(100));
+        lv_obj_add_style(light_cards[i], &gCardWidgetStyle, LV_STATE_DEFAULT);
+        lv_obj_add_style(light_cards[i], &gCardWidgetStyle, LV_STATE_CHECKED);
+        if(i == 0) lv_obj_align(light_cards[i], LV_ALIGN_LEFT_MID, 0, 0);
+        else lv_obj_align_to(light_cards[i], light_cards[i - 1], LV_ALIGN_OUT_RIGHT_MID, 9, 0);
+        lv_snprintf(name, sizeof(name), "Light %u", (unsigned)i + 1);
+        card_create(light_cards[i], &onoffIcon, name, &info_label, "ON");
+        lv_obj_add_flag(light_cards[i], LV_OBJ_FLAG_CHECKABLE);
+    }
+}
+
+static void card_create(lv_obj_t * parent, const lv_img_dsc_t * icon, const char * name, lv_obj_t ** info_label,
+                        const char * info_txt)
+{
+    lv_obj_t * img = lv_img_create(parent);
+    lv_img_set_src(img, icon);
+    lv_obj_set_size(img, icon->header.w, icon->header.h);
+    lv_obj_align(img, LV_ALIGN_TOP_MID, 0, 5);
+    lv_obj_set_style_img_recolor_opa(img, LV_OPA_COVER, 0);
+    lv_obj_set_style_img_recolor(img, lv_palette_main(LV_PALETTE_LIGHT_BLUE), 0);
+
+    lv_obj_t * name_label = lv_label_create(parent);
+    lv_obj_add_style(name_label, &gSmallTextStyle, LV_STATE_DEFAULT);
+    lv_label_set_text(name_label, name);
+    lv_obj_align_to(name_label, img, LV_ALIGN_OUT_BOTTOM_MID, 0, 5);
+
+    *info_label = lv_label_create(parent);
+    lv_obj_add_style(*info_label, &gSmallTextStyle, LV_STATE_DEFAULT);
+    lv_label_set_text(*info_label, info_txt);
+    lv_obj_align_to(*info_label, parent, LV_ALIGN_BOTTOM_MID, 0, -10);
+}
+
+static void full_redraw(uint32_t i)
+{
+    LV_UNUSED(i);
+    lv_obj_invalidate(lv_disp_get_scr_act(disp.disp));
+}
+
+/*The clock and the network state, as the status updates of display_app.cpp*/
+static void status_update(uint32_t i)
+{
+    lv_label_set_text_fmt(hour_label, "%02u:%02u", (unsigned)(i / 60 % 24), (unsigned)(i % 60));
+    lv_label_set_text(network_label, i & 1 ? "CONNECTED" : "UNKNOWN");
+    lv_obj_align_to(network_label, lv_obj_get_parent(network_label), LV_ALIGN_BOTTOM_MID, 0, -10);
+}
+
+static void light_toggle(uint32_t i)
+{
+    if(lv_obj_has_state(light_cards[i % LIGHT_CNT], LV_STATE_CHECKED)) {
+        lv_obj_clear_state(light_cards[i % LIGHT_CNT], LV_STATE_CHECKED);
+    }
+    else {
+        lv_obj_add_state(light_cards[i % LIGHT_CNT], LV_STATE_CHECKED);
+    }
+}
+
+/*Median of RUN_CNT runs of FRAME_CNT frames changed by `frame_cb`*/
+static void measure(const char * name, void (*frame_cb)(uint32_t))
+{
+    lv_obj_style_stats_t start;
+    lv_obj_style_stats_t end;
+    double us[RUN_CNT];
+    uint32_t run;
+    uint32_t i;
+
+    lv_obj_style_get_stats(&start);
+    for(run = 0; run < RUN_CNT; run++) {
+        uint64_t start_us = lv_test_now_us();
+        for(i = 0; i < FRAME_CNT; i++) {
+            frame_cb(i);
+            lv_refr_now(disp.disp);
+        }
+        us[run] = (double)(lv_test_now_us() - start_us) / FRAME_CNT;
+        hash = hash * 31 + lv_test_hash(disp.shown, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t));
+    }
+    lv_obj_style_get_stats(&end);
+    qsort(us, RUN_CNT, sizeof(us[0]), us_cmp);
+
+    uint32_t frames = RUN_CNT * FRAME_CNT;
+    printf("bench_style (%s): %-13s %6u lookups, %6u walks, %6u hits per frame, %7.1f us/frame\n", VARIANT, name,
+           (unsigned)((end.lookups - start.lookups) / frames), (unsigned)((end.walks - start.walks) / frames),
+           (unsigned)((end.hits - start.hits) / frames), us[RUN_CNT / 2]);
+}
+
+static int us_cmp(const void * a, const void * b)
+{
+    double d = *(const double *)a - *(const double *)b;
+    return (d > 0) - (d < 0);
+}
@@ -0,0 +1,99 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file bench_timer.c
+ * Cost of a `lv_timer_handler()` call with 10, 100 and 1000 timers of 10..1000 ms periods,
+ * called every 5 ms. With churn, each call also creates a one-shot timer and pauses and resumes one.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TIMER_MAX   1000
+#define CALL_CNT    20000
+#define CALL_PERIOD 5
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static double measure(uint32_t timer_cnt, bool churn);
+static void timer_cb(lv_timer_t * timer);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_timer_t * timers[TIMER_MAX];
+static volatile uint32_t run_cnt;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static const uint32_t timer_cnts[] = {10, 100, 1000};
+    uint32_t i;
+    uint32_t t;
+
+    lv_init();
+    lv_test_srand(1);
+
+    for(i = 0; i < sizeof(timer_cnts) / sizeof(timer_cnts[0]); i++) {
+        uint32_t timer_cnt = timer_cnts[i];
+        for(t = 0; t < timer_cnt; t++) timers[t] = lv_timer_create(timer_cb, 10 + lv_test_rand(991), NULL);
+
+        double plain_ns = measure(timer_cnt, false);
+        double churn_ns = measure(timer_cnt, true);
+        printf("bench_timer: %4u timers %8.0f ns/call, %8.0f ns/call with churn\n", (unsigned)timer_cnt, plain_ns,
+               churn_ns);
+
+        for(t = 0; t < timer_cnt; t++) lv_timer_del(timers[t]);
+    }
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Best of 5 runs, in ns per call*/
+static double measure(uint32_t timer_cnt, bool churn)
+{
+    double best = 0;
+    uint32_t run;
+    uint32_t i;
+
+    for(run = 0; run < 5; run++) {
+        uint64_t start = lv_test_now_us();
+        for(i = 0; i < CALL_CNT; i++) {
+            if(churn) {
+                lv_timer_t * one_shot = lv_timer_create(timer_cb, 1, NULL);
+                lv_timer_set_repeat_count(one_shot, 1);
+                lv_timer_pause(timers[i % timer_cnt]);
+                lv_timer_resume(timers[i % timer_cnt]);
+            }
+            lv_tick_inc(CALL_PERIOD);
+            lv_timer_handler();
+        }
+        double ns = (double)(lv_test_now_us() - start) * 1000 / CALL_CNT;
+        if(run == 0 || ns < best) best = ns;
+    }
+
+    return best;
+}
+
+static void timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+    run_cnt++;
+}
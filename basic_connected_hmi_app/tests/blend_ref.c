@@ -0,0 +1,21 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file blend_ref.c
+ * The blending of lv_draw_blend.c without the DSP paths, as `blend_ref_fill` and `blend_ref_map`,
+ * to compare with the DSP paths of the LVGL library in the same program.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "blend_ref.h"
+
+#undef __ARM_FEATURE_DSP
+#define _lv_blend_fill  blend_ref_fill
+#define _lv_blend_map   blend_ref_map
+#include "src/draw/lv_draw_blend.c"
@@ -0,0 +1,40 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file blend_ref.h
+ * See blend_ref.c
+ */
+
+#ifndef BLEND_REF_H
+#define BLEND_REF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/** `_lv_blend_fill` mixing the pixels one by one */
+void blend_ref_fill(const lv_area_t * clip_area, const lv_area_t * fill_area, lv_color_t color, lv_opa_t * mask,
+                    lv_draw_mask_res_t mask_res, lv_opa_t opa, lv_blend_mode_t mode);
+
+/** `_lv_blend_map` mixing the pixels one by one */
+void blend_ref_map(const lv_area_t * clip_area, const lv_area_t * map_area, const lv_color_t * map_buf,
+                   lv_opa_t * mask, lv_draw_mask_res_t mask_res, lv_opa_t opa, lv_blend_mode_t mode);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*BLEND_REF_H*/
@@ -0,0 +1,32 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file arm_acle.h
+ * The Cortex-M DSP intrinsics LVGL uses, written in C to run the DSP paths on the host.
+ * Used with -D__ARM_FEATURE_DSP=1; only the results are the ones of the target, not the timing.
+ */
+
+#ifndef DSP_HOST_ARM_ACLE_H
+#define DSP_HOST_ARM_ACLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Dual 16 bit signed multiply with addition of the products and a 32 bit accumulate */
+static inline int32_t __smlad(uint32_t a, uint32_t b, int32_t acc)
+{
+    return acc + (int16_t)(a & 0xFFFF) * (int16_t)(b & 0xFFFF) + (int16_t)(a >> 16) * (int16_t)(b >> 16);
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DSP_HOST_ARM_ACLE_H */
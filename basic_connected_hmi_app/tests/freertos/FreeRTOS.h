@@ -0,0 +1,34 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file FreeRTOS.h
+ * The few FreeRTOS definitions used by the application modules tested on the host.
+ * The critical section is a mutex and a tick is a millisecond.
+ */
+
+#ifndef FREERTOS_HOST_H
+#define FREERTOS_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+
+#define pdFALSE                 0
+#define pdTRUE                  1
+#define portTICK_PERIOD_MS      1
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(ms))
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*FREERTOS_HOST_H*/
@@ -0,0 +1,33 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file freertos_host.c
+ * See FreeRTOS.h
+ */
+
+#include "task.h"
+#include <pthread.h>
+#include <time.h>
+
+static pthread_mutex_t critical = PTHREAD_MUTEX_INITIALIZER;
+
+void vHostEnterCritical(void)
+{
+    pthread_mutex_lock(&critical);
+}
+
+void vHostExitCritical(void)
+{
+    pthread_mutex_unlock(&critical);
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
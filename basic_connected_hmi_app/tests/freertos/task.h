@@ -0,0 +1,32 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file task.h
+ * See FreeRTOS.h
+ */
+
+#ifndef FREERTOS_HOST_TASK_H
+#define FREERTOS_HOST_TASK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "FreeRTOS.h"
+
+void vHostEnterCritical(void);
+void vHostExitCritical(void);
+TickType_t xTaskGetTickCount(void);
+
+#define taskENTER_CRITICAL()    vHostEnterCritical()
+#define taskEXIT_CRITICAL()     vHostExitCritical()
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*FREERTOS_HOST_TASK_H*/
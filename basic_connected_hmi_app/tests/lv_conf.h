@@ -0,0 +1,59 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file lv_conf.h
+ * LVGL configuration of the host tests: the one of the application without the PXP.
+ */
+
+#ifndef LV_TEST_CONF_H
+#define LV_TEST_CONF_H
+
+#include "../src/main/include/lv_conf.h"
+
+/* The PXP is replaced by the CPU drawing on the host */
+#undef LV_USE_GPU_NXP_PXP
+#define LV_USE_GPU_NXP_PXP 0
+#undef LV_USE_GPU_NXP_PXP_AUTO_INIT
+#define LV_USE_GPU_NXP_PXP_AUTO_INIT 0
+
+/* No OCRAM section on the host */
+#undef LV_ATTRIBUTE_MEM_BUF_ARENA
+#define LV_ATTRIBUTE_MEM_BUF_ARENA
+
+/* Fail the test instead of halting */
+#undef LV_ASSERT_HANDLER_INCLUDE
+#define LV_ASSERT_HANDLER_INCLUDE <stdlib.h>
+#undef LV_ASSERT_HANDLER
+#define LV_ASSERT_HANDLER abort();
+
+/* Variants of the benchmarks without a cache, to compare with */
+#ifdef LV_TEST_NO_SHADOW_CACHE
+#undef LV_SHADOW_CACHE_SIZE
+#define LV_SHADOW_CACHE_SIZE 0
+#endif
+#ifdef LV_TEST_NO_GLYPH_CACHE
+#undef LV_GLYPH_CACHE_SIZE
+#define LV_GLYPH_CACHE_SIZE 0
+#endif
+#ifdef LV_TEST_NO_STYLE_CACHE
+#undef LV_STYLE_CACHE_SIZE
+#define LV_STYLE_CACHE_SIZE 0
+#endif
+
+/* A font with kern pairs (Montserrat uses kern classes), built into the benchmarks needing it */
+#ifdef LV_TEST_KERN_PAIRS_FONT
+#undef LV_FONT_DEJAVU_16_PERSIAN_HEBREW
+#define LV_FONT_DEJAVU_16_PERSIAN_HEBREW 1
+#endif
+
+/* A compressed font, built into the benchmarks needing it */
+#ifdef LV_TEST_COMPRESSED_FONT
+#undef LV_FONT_MONTSERRAT_28_COMPRESSED
+#define LV_FONT_MONTSERRAT_28_COMPRESSED 1
+#endif
+
+#endif /*LV_TEST_CONF_H*/
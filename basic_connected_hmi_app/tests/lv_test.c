@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file lv_test.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include <string.h>
+#include <time.h>
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t rand_state = 1;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_test_disp_init(lv_test_disp_t * disp, bool full)
+{
+    uint32_t px_cnt = LCD_WIDTH * LCD_HEIGHT;
+
+    memset(disp, 0, sizeof(*disp));
+    disp->buf1 = calloc(px_cnt, sizeof(lv_color_t));
+    disp->buf2 = full ? NULL : calloc(px_cnt, sizeof(lv_color_t));
+    disp->shown = calloc(px_cnt, sizeof(lv_color_t));
+    LV_TEST_ASSERT(disp->buf1 && disp->shown && (full || disp->buf2));
+
+    lv_disp_draw_buf_init(&disp->draw_buf, disp->buf1, disp->buf2, px_cnt);
+
+    lv_disp_drv_init(&disp->drv);
+    disp->drv.hor_res = LCD_WIDTH;
+    disp->drv.ver_res = LCD_HEIGHT;
+    disp->drv.flush_cb = flush_cb;
+    disp->drv.draw_buf = &disp->draw_buf;
+    disp->drv.user_data = disp;
+    if(full) disp->drv.full_refresh = 1;
+    else disp->drv.direct_mode = 1;
+
+    disp->disp = lv_disp_drv_register(&disp->drv);
+
+    /*Only the first display gets the default theme, use it on all of them to draw the same*/
+    if(lv_disp_get_theme(disp->disp) == NULL) {
+        lv_disp_set_theme(disp->disp, lv_disp_get_theme(lv_disp_get_default()));
+    }
+}
+
+void lv_test_run(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_timer_handler();
+}
+
+double lv_test_bench_redraw(lv_obj_t * obj, uint32_t frames)
+{
+    double best = 0;
+    uint32_t run;
+    uint32_t i;
+
+    for(run = 0; run < 5; run++) {
+        uint64_t start = lv_test_now_us();
+        for(i = 0; i < frames; i++) {
+            lv_obj_invalidate(obj);
+            lv_refr_now(lv_obj_get_disp(obj));
+        }
+        double us = (double)(lv_test_now_us() - start) / frames;
+        if(run == 0 || us < best) best = us;
+    }
+
+    return best;
+}
+
+uint64_t lv_test_now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint64_t lv_test_hash(const void * data, size_t size)
+{
+    const uint8_t * p = data;
+    uint64_t h = 1469598103934665603ULL;
+    size_t i;
+    for(i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+void lv_test_srand(uint32_t seed)
+{
+    rand_state = seed ? seed : 1;
+}
+
+uint32_t lv_test_rand(uint32_t max)
+{
+    /*xorshift32*/
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return max ? rand_state % max : rand_state;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    LV_UNUSED(area);
+    lv_test_disp_t * disp = drv->user_data;
+
+    /*The buffers are screen sized, the panel shows the whole buffer when its last area is flushed*/
+    if(lv_disp_flush_is_last(drv)) {
+        memcpy(disp->shown, color_p, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t));
+        disp->flushes++;
+    }
+    lv_disp_flush_ready(drv);
+}
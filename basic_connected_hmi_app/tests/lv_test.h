@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file lv_test.h
+ * Helpers of the host tests and benchmarks.
+ */
+
+#ifndef LV_TEST_H
+#define LV_TEST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/* Fail the test with the location of the check */
+#define LV_TEST_ASSERT(cond)                                                             \
+    do {                                                                                 \
+        if(!(cond)) {                                                                    \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);     \
+            exit(1);                                                                     \
+        }                                                                                \
+    } while(0)
+
+#define LV_TEST_ASSERT_INT_EQ(expected, actual)                                          \
+    do {                                                                                 \
+        long long _e = (long long)(expected);                                            \
+        long long _a = (long long)(actual);                                              \
+        if(_e != _a) {                                                                   \
+            fprintf(stderr, "%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__,    \
+                    #actual, _a, _e);                                                    \
+            exit(1);                                                                     \
+        }                                                                                \
+    } while(0)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_disp_t * disp;
+    lv_disp_drv_t drv;
+    lv_disp_draw_buf_t draw_buf;
+    lv_color_t * buf1;
+    lv_color_t * buf2;
+    lv_color_t * shown;     /* Last frame flushed to the "panel" */
+    uint32_t flushes;
+} lv_test_disp_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register a display of the size of the panel, with screen sized buffers.
+ * @param disp      the display to initialize, must stay valid while the display is used
+ * @param full      true: full refresh with one buffer, false: direct mode with two buffers
+ */
+void lv_test_disp_init(lv_test_disp_t * disp, bool full);
+
+/** Run the timers and the refresh of every display, as if `ms` milliseconds elapsed */
+void lv_test_run(uint32_t ms);
+
+/**
+ * Redraw an object at once a number of times, best of a few runs.
+ * @param obj       the object to invalidate before each redraw
+ * @param frames    redraws per run
+ * @return          the average time of a redraw in microseconds
+ */
+double lv_test_bench_redraw(lv_obj_t * obj, uint32_t frames);
+
+/** Monotonic time in microseconds */
+uint64_t lv_test_now_us(void);
+
+/** FNV-1a hash of a buffer, to compare frames */
+uint64_t lv_test_hash(const void * data, size_t size);
+
+/** Deterministic pseudo random numbers, independent of the C library */
+void lv_test_srand(uint32_t seed);
+uint32_t lv_test_rand(uint32_t max);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_TEST_H*/
@@ -0,0 +1,121 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file test_blend_dsp.c
+ * The RGB565 pixel pair paths of the normal blending (built with the DSP instructions emulated, see dsp/)
+ * must give the same pixels as the per pixel mixing.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include "blend_ref.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define BUF_W       LCD_WIDTH
+#define BUF_H       64
+#define CASE_CNT    20000
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void random_mask(lv_opa_t * mask, uint32_t len);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_color_t map[BUF_W * BUF_H];
+static lv_opa_t mask[BUF_W * BUF_H];
+static lv_opa_t mask_ref[BUF_W * BUF_H];
+static lv_color_t before[BUF_W * BUF_H];
+static lv_color_t blended[BUF_W * BUF_H];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static lv_test_disp_t disp;
+    uint32_t c;
+    uint32_t i;
+
+    lv_init();
+    lv_test_disp_init(&disp, true);
+
+    /*Blend into the top of the display buffer as the refresh does*/
+    lv_disp_draw_buf_t * draw_buf = lv_disp_get_draw_buf(disp.disp);
+    lv_color_t * buf = draw_buf->buf_act;
+    lv_area_t clip = {0, 0, BUF_W - 1, BUF_H - 1};
+    lv_area_copy(&draw_buf->area, &clip);
+    _lv_refr_set_disp_refreshing(disp.disp);
+
+    lv_test_srand(3);
+    for(i = 0; i < BUF_W * BUF_H; i++) {
+        buf[i].full = lv_test_rand(0);
+        map[i].full = lv_test_rand(0);
+    }
+
+    for(c = 0; c < CASE_CNT; c++) {
+        lv_area_t area;
+        area.x1 = lv_test_rand(BUF_W);
+        area.y1 = lv_test_rand(BUF_H);
+        area.x2 = area.x1 + lv_test_rand(BUF_W - area.x1);
+        area.y2 = area.y1 + lv_test_rand(BUF_H - area.y1);
+
+        /*Opaque, nearly opaque and any opacity*/
+        lv_opa_t opa = lv_test_rand(3) == 0 ? LV_OPA_COVER : lv_test_rand(3) == 0 ? 252 + lv_test_rand(4) :
+                       lv_test_rand(256);
+        lv_draw_mask_res_t mask_res = lv_test_rand(3) == 0 ? LV_DRAW_MASK_RES_FULL_COVER : LV_DRAW_MASK_RES_CHANGED;
+        bool fill = lv_test_rand(2);
+        lv_color_t color;
+        color.full = lv_test_rand(0);
+        random_mask(mask, lv_area_get_size(&area));
+        lv_memcpy(mask_ref, mask, sizeof(mask));
+        lv_memcpy(before, buf, sizeof(before));
+
+        if(fill) _lv_blend_fill(&clip, &area, color, mask, mask_res, opa, LV_BLEND_MODE_NORMAL);
+        else _lv_blend_map(&clip, &area, map, mask, mask_res, opa, LV_BLEND_MODE_NORMAL);
+        lv_memcpy(blended, buf, sizeof(blended));
+
+        lv_memcpy(buf, before, sizeof(before));
+        if(fill) blend_ref_fill(&clip, &area, color, mask_ref, mask_res, opa, LV_BLEND_MODE_NORMAL);
+        else blend_ref_map(&clip, &area, map, mask_ref, mask_res, opa, LV_BLEND_MODE_NORMAL);
+
+        if(memcmp(blended, buf, sizeof(blended)) != 0) {
+            fprintf(stderr, "case %u: %s of %dx%d, opa %u, %s differs from the per pixel mixing\n", (unsigned)c,
+                    fill ? "fill" : "map", lv_area_get_width(&area), lv_area_get_height(&area), opa,
+                    mask_res == LV_DRAW_MASK_RES_CHANGED ? "with mask" : "without mask");
+            return 1;
+        }
+    }
+
+    _lv_refr_set_disp_refreshing(NULL);
+
+    printf("test_blend_dsp: %u fills and maps identical to the per pixel mixing\n", (unsigned)CASE_CNT);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Any values, or mostly transparent and opaque pixels with edges as the masks of shapes and glyphs*/
+static void random_mask(lv_opa_t * m, uint32_t len)
+{
+    bool any = lv_test_rand(3) == 0;
+    uint32_t i;
+    for(i = 0; i < len; i++) {
+        uint32_t r = lv_test_rand(4);
+        if(any || r >= 2) m[i] = lv_test_rand(256);
+        else m[i] = r == 0 ? LV_OPA_TRANSP : LV_OPA_COVER;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file test_circle_cache.c
+ * The radius masks must give the same coverage with the circle tables, with a budget small enough
+ * to drop tables all the time and without tables.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CASE_CNT        40000
+#define LINES_PER_CASE  3
+#define LINE_MAX        400
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void run_cases(uint64_t * hashes);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static uint64_t reference[CASE_CNT * LINES_PER_CASE];
+    static uint64_t cached[CASE_CNT * LINES_PER_CASE];
+    static const uint32_t budgets[] = {LV_CIRCLE_CACHE_BUDGET, 1024};
+    uint32_t b;
+    uint32_t i;
+
+    lv_init();
+
+    lv_draw_mask_circle_cache_set_budget(0);
+    run_cases(reference);
+
+    for(b = 0; b < sizeof(budgets) / sizeof(budgets[0]); b++) {
+        lv_draw_mask_circle_cache_set_budget(budgets[b]);
+        run_cases(cached);
+        for(i = 0; i < CASE_CNT * LINES_PER_CASE; i++) {
+            if(cached[i] != reference[i]) {
+                fprintf(stderr, "budget %u: line %u of case %u differs from the computed corner\n",
+                        (unsigned)budgets[b], (unsigned)(i % LINES_PER_CASE), (unsigned)(i / LINES_PER_CASE));
+                return 1;
+            }
+        }
+    }
+
+    printf("test_circle_cache: %u mask lines identical with and without the circle tables\n",
+           (unsigned)(CASE_CNT * LINES_PER_CASE));
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Random rectangles, radii, inner and outer masks, partial lines on pre-filled masks*/
+static void run_cases(uint64_t * hashes)
+{
+    lv_opa_t buf[LINE_MAX];
+    uint32_t c;
+    uint32_t l;
+    uint32_t i;
+
+    lv_test_srand(7);
+    for(c = 0; c < CASE_CNT; c++) {
+        lv_area_t rect;
+        rect.x1 = lv_test_rand(100) - 50;
+        rect.y1 = lv_test_rand(100) - 50;
+        rect.x2 = rect.x1 + lv_test_rand(200);
+        rect.y2 = rect.y1 + lv_test_rand(200);
+        lv_coord_t radius = lv_test_rand(5) == 0 ? LV_RADIUS_CIRCLE : lv_test_rand(80);
+        bool outer = lv_test_rand(2);
+
+        lv_draw_mask_radius_param_t param;
+        lv_draw_mask_radius_init(&param, &rect, radius, outer);
+
+        lv_coord_t len = 1 + lv_test_rand(LINE_MAX);
+        lv_coord_t x = lv_test_rand(400) - 250;
+        lv_coord_t y = rect.y1 + lv_test_rand(lv_area_get_height(&rect) + 4) - 2;
+
+        /*Consecutive lines reuse the previous square root*/
+        for(l = 0; l < LINES_PER_CASE; l++) {
+            for(i = 0; i < (uint32_t)len; i++) buf[i] = lv_test_rand(3) == 0 ? LV_OPA_COVER : lv_test_rand(256);
+
+            lv_draw_mask_res_t res = param.dsc.cb(buf, x, y + l, len, &param);
+            if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(buf, len);
+            hashes[c * LINES_PER_CASE + l] = lv_test_hash(buf, len);
+        }
+    }
+}
@@ -0,0 +1,324 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file test_display_queue.cpp
+ * The display queue keeps the latest state and never drops it, only the logs are lossy.
+ * Several producer threads post to one consumer, like the Matter tasks to the display task.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include "display_queue.h"
+#include <atomic>
+#include <chrono>
+#include <string.h>
+#include <thread>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define PRODUCER_CNT            4
+#define PRODUCER_ITERATIONS     200000
+/* Devices of the binding table, each producer posts to its own ones */
+#define PRODUCER_DEVICES        8
+/* A log line every LOG_PERIOD iterations */
+#define LOG_PERIOD              4
+#define CONSUMER_PERIOD_US      100
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t lastSeq[PRODUCER_CNT];
+    uint32_t lastLogSeq[PRODUCER_CNT];
+    uint32_t logs;
+    uint32_t takes;
+} consumer_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void test_coalescing(void);
+static void test_table(void);
+static void test_logs(void);
+static void test_producers(void);
+static void producer(uint32_t id);
+static void consume(consumer_t * consumer, DisplayState_t * state);
+static void wakeup_cb(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static std::atomic<uint32_t> wakeups;
+static std::atomic<uint32_t> producersDone;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    display_queue_set_wakeup_cb(wakeup_cb);
+
+    test_coalescing();
+    test_table();
+    test_logs();
+    test_producers();
+
+    printf("test_display_queue: %d producers, %d updates each, no state lost\n", PRODUCER_CNT, PRODUCER_ITERATIONS);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void test_coalescing(void)
+{
+    static DisplayState_t state;
+    static DisplayStateDirty_t dirty;
+    DisplayQueueStats_t before;
+    DisplayQueueStats_t after;
+
+    display_queue_get_stats(&before);
+    LV_TEST_ASSERT(!display_queue_take_state(&state, &dirty));
+
+    /* A burst of updates wakes the display task once and shows the last value */
+    uint32_t wakeupsBefore = wakeups;
+    display_queue_lock()->networkState = connected;
+    display_queue_unlock(kDisplayState_NetworkState);
+    display_queue_lock()->networkState = disconnected;
+    display_queue_unlock(kDisplayState_NetworkState);
+    display_queue_lock()->matterChannel = 15;
+    display_queue_unlock(kDisplayState_MatterChannel);
+    LV_TEST_ASSERT(display_queue_post_device(kDisplayDevice_OnOff, 3, 1));
+    LV_TEST_ASSERT(display_queue_post_device(kDisplayDevice_OnOff, 3, 0));
+    LV_TEST_ASSERT(!display_queue_post_device(kDisplayDevice_OnOff, DISPLAY_QUEUE_DEVICES, 1));
+    LV_TEST_ASSERT_INT_EQ(wakeupsBefore + 1, wakeups);
+
+    LV_TEST_ASSERT(display_queue_take_state(&state, &dirty));
+    LV_TEST_ASSERT_INT_EQ((1U << kDisplayState_NetworkState) | (1U << kDisplayState_MatterChannel), dirty.fields);
+    LV_TEST_ASSERT_INT_EQ(disconnected, state.networkState);
+    LV_TEST_ASSERT_INT_EQ(15, state.matterChannel);
+    LV_TEST_ASSERT_INT_EQ(1, DISPLAY_QUEUE_DEVICE_DIRTY(&dirty, kDisplayDevice_OnOff, 3));
+    LV_TEST_ASSERT_INT_EQ(0, DISPLAY_QUEUE_DEVICE_DIRTY(&dirty, kDisplayDevice_OnOff, 2));
+    LV_TEST_ASSERT_INT_EQ(0, state.devices[kDisplayDevice_OnOff][3]);
+    LV_TEST_ASSERT(!display_queue_take_state(&state, &dirty));
+
+    display_queue_get_stats(&after);
+    LV_TEST_ASSERT_INT_EQ(5, after.posted - before.posted);
+    LV_TEST_ASSERT_INT_EQ(2, after.coalesced - before.coalesced);
+    LV_TEST_ASSERT_INT_EQ(1, after.rejected - before.rejected);
+
+    /* The fields which didn't change keep their value */
+    display_queue_lock()->matterPanId = 0xABCD;
+    display_queue_unlock(kDisplayState_MatterPanID);
+    LV_TEST_ASSERT(display_queue_take_state(&state, &dirty));
+    LV_TEST_ASSERT_INT_EQ(1U << kDisplayState_MatterPanID, dirty.fields);
+    LV_TEST_ASSERT_INT_EQ(0xABCD, state.matterPanId);
+    LV_TEST_ASSERT_INT_EQ(disconnected, state.networkState);
+}
+
+static void test_table(void)
+{
+    static DisplayState_t state;
+    static DisplayStateDirty_t dirty;
+
+    /* The connection and network updates posted before a table are replaced by it, not the on/off states */
+    display_queue_post_device(kDisplayDevice_Connection, 1, 1);
+    display_queue_post_device(kDisplayDevice_NetworkType, 2, 4);
+    display_queue_post_device(kDisplayDevice_OnOff, 1, 1);
+
+    DisplayState_t * pending = display_queue_lock();
+    pending->table.total = 40;
+    memset(pending->table.onOff, 0, sizeof(pending->table.onOff));
+    pending->table.onOff[1] = 1U << 3;
+    display_queue_unlock(kDisplayState_Table);
+
+    display_queue_post_device(kDisplayDevice_Connection, 35, 1);
+
+    LV_TEST_ASSERT(display_queue_take_state(&state, &dirty));
+    LV_TEST_ASSERT_INT_EQ(1U << kDisplayState_Table, dirty.fields);
+    LV_TEST_ASSERT_INT_EQ(40, state.table.total);
+    LV_TEST_ASSERT_INT_EQ(1U << 3, state.table.onOff[1]);
+    LV_TEST_ASSERT_INT_EQ(0, DISPLAY_QUEUE_DEVICE_DIRTY(&dirty, kDisplayDevice_Connection, 1));
+    LV_TEST_ASSERT_INT_EQ(0, DISPLAY_QUEUE_DEVICE_DIRTY(&dirty, kDisplayDevice_NetworkType, 2));
+    LV_TEST_ASSERT_INT_EQ(1, DISPLAY_QUEUE_DEVICE_DIRTY(&dirty, kDisplayDevice_OnOff, 1));
+    LV_TEST_ASSERT_INT_EQ(1, DISPLAY_QUEUE_DEVICE_DIRTY(&dirty, kDisplayDevice_Connection, 35));
+    LV_TEST_ASSERT_INT_EQ(1, state.devices[kDisplayDevice_Connection][35]);
+}
+
+static void test_logs(void)
+{
+    DisplayQueueStats_t before;
+    DisplayQueueStats_t after;
+    DisplayLog_t log;
+    char longLine[300];
+
+    display_queue_get_stats(&before);
+
+    /* The length is honored, not the terminator */
+    LV_TEST_ASSERT(display_queue_post_log("abcdef", 3, true));
+    LV_TEST_ASSERT(display_queue_take_log(&log));
+    LV_TEST_ASSERT_INT_EQ(3, log.length);
+    LV_TEST_ASSERT(strcmp(log.text, "abc") == 0);
+    LV_TEST_ASSERT(log.clear);
+
+    /* A long line is cut and counted */
+    for(uint32_t i = 0; i < sizeof(longLine); i++) longLine[i] = 'a' + i % 26;
+    LV_TEST_ASSERT(display_queue_post_log(longLine, sizeof(longLine), false));
+    LV_TEST_ASSERT(display_queue_take_log(&log));
+    LV_TEST_ASSERT_INT_EQ(DISPLAY_QUEUE_TEXT_SIZE - 1, log.length);
+    LV_TEST_ASSERT_INT_EQ(DISPLAY_QUEUE_TEXT_SIZE - 1, strlen(log.text));
+    LV_TEST_ASSERT(memcmp(log.text, longLine, DISPLAY_QUEUE_TEXT_SIZE - 1) == 0);
+
+    /* The lines beyond the queue size are dropped and counted, the queued ones are kept in order */
+    for(uint32_t i = 0; i < DISPLAY_QUEUE_LOG_SIZE + 3; i++){
+        char line[16];
+        int length = snprintf(line, sizeof(line), "line %u", (unsigned) i);
+        LV_TEST_ASSERT_INT_EQ(i < DISPLAY_QUEUE_LOG_SIZE, display_queue_post_log(line, length, false));
+    }
+    for(uint32_t i = 0; i < DISPLAY_QUEUE_LOG_SIZE; i++){
+        char line[16];
+        snprintf(line, sizeof(line), "line %u", (unsigned) i);
+        LV_TEST_ASSERT(display_queue_take_log(&log));
+        LV_TEST_ASSERT(strcmp(log.text, line) == 0);
+    }
+    LV_TEST_ASSERT(!display_queue_take_log(&log));
+
+    display_queue_get_stats(&after);
+    LV_TEST_ASSERT_INT_EQ(2 + DISPLAY_QUEUE_LOG_SIZE, after.posted - before.posted);
+    LV_TEST_ASSERT_INT_EQ(3, after.overflows - before.overflows);
+    LV_TEST_ASSERT_INT_EQ(1, after.truncated - before.truncated);
+}
+
+/*
+ * The producers post their sequence number to a shared field (the date: month = producer,
+ * day:year = sequence), to their own devices and in log lines. The consumer checks that
+ * a producer's values never go back, that the logs of a producer arrive in order and intact,
+ * and after the producers are done, that the last value of every device is shown.
+ */
+static void test_producers(void)
+{
+    static DisplayState_t state;
+    DisplayQueueStats_t before;
+    DisplayQueueStats_t after;
+    std::thread threads[PRODUCER_CNT];
+    consumer_t consumer;
+
+    memset(&consumer, 0, sizeof(consumer));
+    display_queue_get_stats(&before);
+
+    for(uint32_t p = 0; p < PRODUCER_CNT; p++){
+        threads[p] = std::thread(producer, p);
+    }
+
+    while(producersDone != PRODUCER_CNT){
+        consume(&consumer, &state);
+        /* The display task renders between two takes */
+        std::this_thread::sleep_for(std::chrono::microseconds(CONSUMER_PERIOD_US));
+    }
+
+    for(uint32_t p = 0; p < PRODUCER_CNT; p++){
+        threads[p].join();
+    }
+    consume(&consumer, &state);
+
+    /* Never dropped: the last value posted to every device is shown */
+    for(uint32_t p = 0; p < PRODUCER_CNT; p++){
+        for(uint32_t d = 0; d < PRODUCER_DEVICES; d++){
+            uint32_t device = p * PRODUCER_DEVICES + d;
+            uint32_t lastIteration = PRODUCER_ITERATIONS - PRODUCER_DEVICES + d;
+            LV_TEST_ASSERT_INT_EQ((lastIteration / PRODUCER_DEVICES) & 0xFF, state.devices[kDisplayDevice_Connection][device]);
+            LV_TEST_ASSERT_INT_EQ((lastIteration + p) & 0xFF, state.devices[kDisplayDevice_NetworkType][device]);
+        }
+    }
+
+    display_queue_get_stats(&after);
+    int64_t statePosts = PRODUCER_CNT * PRODUCER_ITERATIONS * 3;
+    int64_t logPosts = PRODUCER_CNT * (PRODUCER_ITERATIONS / LOG_PERIOD);
+    int64_t logsDropped = after.overflows - before.overflows;
+    LV_TEST_ASSERT_INT_EQ(statePosts + logPosts - logsDropped, after.posted - before.posted);
+    LV_TEST_ASSERT_INT_EQ(logPosts, consumer.logs + logsDropped);
+    /* A take shows at most the date and the two fields of every device, the other updates were coalesced */
+    int64_t shownMax = (int64_t) consumer.takes * (1 + PRODUCER_CNT * PRODUCER_DEVICES * 2);
+    LV_TEST_ASSERT((int64_t) (after.coalesced - before.coalesced) >= statePosts - shownMax);
+
+    printf("test_display_queue: %u state takes, %u logs shown, %u logs dropped\n", (unsigned) consumer.takes,
+           (unsigned) consumer.logs, (unsigned) logsDropped);
+}
+
+/* Takes what the producers posted and checks it */
+static void consume(consumer_t * consumer, DisplayState_t * state)
+{
+    DisplayStateDirty_t dirty;
+    DisplayLog_t log;
+
+    if(display_queue_take_state(state, &dirty)){
+        consumer->takes++;
+        if(dirty.fields & (1U << kDisplayState_Date)){
+            uint32_t p = state->date.month;
+            uint32_t seq = state->date.year | ((uint32_t) state->date.day << 16);
+            LV_TEST_ASSERT(p < PRODUCER_CNT);
+            LV_TEST_ASSERT(seq > consumer->lastSeq[p]);
+            consumer->lastSeq[p] = seq;
+        }
+    }
+
+    while(display_queue_take_log(&log)){
+        unsigned p;
+        unsigned seq;
+        char expected[DISPLAY_QUEUE_TEXT_SIZE];
+        LV_TEST_ASSERT_INT_EQ(2, sscanf(log.text, "producer %u seq %u", &p, &seq));
+        LV_TEST_ASSERT(p < PRODUCER_CNT);
+        LV_TEST_ASSERT(seq > consumer->lastLogSeq[p]);
+        snprintf(expected, sizeof(expected), "producer %u seq %u checksum %u", p, seq, (p * 7919 + seq * 31) & 0xFFFF);
+        LV_TEST_ASSERT(strcmp(log.text, expected) == 0);
+        LV_TEST_ASSERT_INT_EQ(strlen(log.text), log.length);
+        consumer->lastLogSeq[p] = seq;
+        consumer->logs++;
+    }
+}
+
+static void producer(uint32_t id)
+{
+    for(uint32_t i = 1; i <= PRODUCER_ITERATIONS; i++){
+        uint32_t device = id * PRODUCER_DEVICES + (i - 1) % PRODUCER_DEVICES;
+
+        display_queue_post_device(kDisplayDevice_Connection, device, ((i - 1) / PRODUCER_DEVICES) & 0xFF);
+        display_queue_post_device(kDisplayDevice_NetworkType, device, (i - 1 + id) & 0xFF);
+
+        if(i % LOG_PERIOD == 0){
+            char line[DISPLAY_QUEUE_TEXT_SIZE];
+            int length = snprintf(line, sizeof(line), "producer %u seq %u checksum %u", (unsigned) id, (unsigned) i,
+                                  (unsigned) ((id * 7919 + i * 31) & 0xFFFF));
+            display_queue_post_log(line, length, false);
+
+            /* Read while the consumer counts the latencies, as the shell task does */
+            DisplayQueueStats_t stats;
+            display_queue_get_stats(&stats);
+            LV_TEST_ASSERT(stats.avgLatencyMs <= stats.maxLatencyMs);
+        }
+
+        DisplayState_t * state = display_queue_lock();
+        state->date.month = id;
+        state->date.year = i & 0xFFFF;
+        state->date.day = i >> 16;
+        display_queue_unlock(kDisplayState_Date);
+
+        /* Let the consumer in, like a task waiting for its next event */
+        std::this_thread::yield();
+    }
+
+    producersDone++;
+}
+static void wakeup_cb(void)
+{
+    wakeups++;
+}
@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file test_glyph_cache.c
+ * A font loaded at the address of a freed one must not be drawn with the cached glyphs of the freed font,
+ * even if its glyphs have the same size.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define GLYPH_W     8
+#define GLYPH_H     12
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_font_t * font_create(const uint8_t * bitmap);
+static bool get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * g, uint32_t letter, uint32_t letter_next);
+static const uint8_t * get_glyph_bitmap(const lv_font_t * font, uint32_t letter);
+static uint64_t draw(lv_font_t * font);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t solid[GLYPH_W * GLYPH_H];
+static uint8_t checker[GLYPH_W * GLYPH_H];
+static lv_test_disp_t disp;
+static lv_obj_t * label;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    uint32_t i;
+
+    lv_init();
+    lv_test_disp_init(&disp, true);
+    label = lv_label_create(lv_disp_get_scr_act(disp.disp));
+    lv_label_set_text(label, "ABBA");
+
+    for(i = 0; i < GLYPH_W * GLYPH_H; i++) {
+        solid[i] = LV_OPA_COVER;
+        checker[i] = ((i / GLYPH_W + i) & 1) ? LV_OPA_COVER : LV_OPA_TRANSP;
+    }
+
+    /*The glyphs of the freed font are cached*/
+    lv_font_t * freed = font_create(solid);
+    uint64_t solid_hash = draw(freed);
+    lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, 0);
+    lv_font_free(freed);
+
+    /*The heap gives the same blocks again*/
+    lv_font_t * loaded = font_create(checker);
+    LV_TEST_ASSERT(loaded == freed);
+    uint64_t loaded_hash = draw(loaded);
+
+    /*The same glyphs at another address*/
+    lv_font_t * other = font_create(checker);
+    uint64_t other_hash = draw(other);
+
+    LV_TEST_ASSERT(solid_hash != other_hash);
+    LV_TEST_ASSERT(loaded_hash == other_hash);
+
+    lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, 0);
+    lv_font_free(loaded);
+    lv_font_free(other);
+
+    printf("test_glyph_cache: a font loaded at the address of a freed one is drawn with its own glyphs\n");
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*Allocated as `lv_font_load` does, so it's freed by `lv_font_free`*/
+static lv_font_t * font_create(const uint8_t * bitmap)
+{
+    lv_font_t * font = lv_mem_alloc(sizeof(lv_font_t));
+    lv_font_fmt_txt_dsc_t * dsc = lv_mem_alloc(sizeof(lv_font_fmt_txt_dsc_t));
+    LV_TEST_ASSERT(font && dsc);
+    lv_memset_00(font, sizeof(lv_font_t));
+    lv_memset_00(dsc, sizeof(lv_font_fmt_txt_dsc_t));
+
+    font->get_glyph_dsc = get_glyph_dsc;
+    font->get_glyph_bitmap = get_glyph_bitmap;
+    font->line_height = GLYPH_H + 4;
+    font->base_line = 2;
+    font->dsc = dsc;
+    font->user_data = (void *)bitmap;
+    return font;
+}
+
+static bool get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * g, uint32_t letter, uint32_t letter_next)
+{
+    LV_UNUSED(font);
+    LV_UNUSED(letter);
+    LV_UNUSED(letter_next);
+
+    g->adv_w = GLYPH_W + 2;
+    g->box_w = GLYPH_W;
+    g->box_h = GLYPH_H;
+    g->ofs_x = 0;
+    g->ofs_y = 0;
+    g->bpp = 8;
+    return true;
+}
+
+static const uint8_t * get_glyph_bitmap(const lv_font_t * font, uint32_t letter)
+{
+    LV_UNUSED(letter);
+    return font->user_data;
+}
+
+static uint64_t draw(lv_font_t * font)
+{
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_test_bench_redraw(lv_disp_get_scr_act(disp.disp), 1);
+    return lv_test_hash(disp.shown, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t));
+}
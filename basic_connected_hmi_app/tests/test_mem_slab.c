@@ -0,0 +1,133 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file test_mem_slab.c
+ * Soak test of the slab allocator: deleting and creating random widgets among live ones
+ * must not leak, corrupt the heap, fragment it or overflow the slabs.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LIVE_CNT        120
+#define CYCLE_CNT       1000000
+#define CHECK_PERIOD    100000
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_obj_t * widget_create(lv_obj_t * parent);
+static void event_cb(lv_event_t * e);
+static uint32_t heap_used(const lv_mem_monitor_t * mon);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static lv_test_disp_t disp;
+    static lv_obj_t * live[LIVE_CNT];
+    lv_mem_monitor_t start;
+    lv_mem_monitor_t mon;
+    uint8_t max_frag_pct = 0;
+    uint32_t i;
+
+    lv_init();
+    lv_test_disp_init(&disp, true);
+    lv_obj_t * scr = lv_disp_get_scr_act(disp.disp);
+
+    /*The screen keeps the attributes allocated for its first child*/
+    lv_obj_del(lv_obj_create(scr));
+    lv_mem_monitor(&start);
+
+    lv_test_srand(3);
+    for(i = 0; i < LIVE_CNT; i++) live[i] = widget_create(scr);
+
+    uint64_t start_us = lv_test_now_us();
+    for(i = 1; i <= CYCLE_CNT; i++) {
+        uint32_t victim = lv_test_rand(LIVE_CNT);
+        lv_obj_del(live[victim]);
+        live[victim] = widget_create(scr);
+
+        if(i % CHECK_PERIOD == 0) {
+            LV_TEST_ASSERT(lv_mem_test() == LV_RES_OK);
+            lv_mem_monitor(&mon);
+            max_frag_pct = LV_MAX(max_frag_pct, mon.frag_pct);
+        }
+    }
+    double cycle_us = (double)(lv_test_now_us() - start_us) / CYCLE_CNT;
+
+    lv_mem_monitor(&mon);
+    LV_TEST_ASSERT_INT_EQ(0, mon.slab_fallback_cnt);
+    uint32_t live_heap = heap_used(&mon);
+    uint32_t live_slab = mon.slab_used;
+
+    /*Everything returns to the pools*/
+    for(i = 0; i < LIVE_CNT; i++) lv_obj_del(live[i]);
+    lv_mem_monitor(&mon);
+    LV_TEST_ASSERT_INT_EQ(heap_used(&start), heap_used(&mon));
+    LV_TEST_ASSERT_INT_EQ(start.slab_used, mon.slab_used);
+    LV_TEST_ASSERT(lv_mem_test() == LV_RES_OK);
+
+    printf("test_mem_slab: %u cycles with %u live widgets (%u B in the heap, %u B in the slabs), "
+           "at most %u%% heap fragmentation, no leak, %.2f us/cycle\n", (unsigned)CYCLE_CNT, (unsigned)LIVE_CNT,
+           (unsigned)live_heap, (unsigned)live_slab, (unsigned)max_frag_pct, cycle_us);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/*The widgets of the HMI with their small allocations: texts, event lists, local styles and cells*/
+static lv_obj_t * widget_create(lv_obj_t * parent)
+{
+    lv_obj_t * obj;
+    switch(lv_test_rand(5)) {
+        case 0:
+            obj = lv_obj_create(parent);
+            break;
+        case 1:
+            obj = lv_label_create(parent);
+            lv_label_set_text_fmt(obj, "Light %u", (unsigned)lv_test_rand(100));
+            break;
+        case 2:
+            obj = lv_btn_create(parent);
+            lv_obj_add_event_cb(obj, event_cb, LV_EVENT_CLICKED, NULL);
+            lv_label_set_text(lv_label_create(obj), "OK");
+            break;
+        case 3:
+            obj = lv_img_create(parent);
+            lv_img_set_src(obj, LV_SYMBOL_OK);
+            break;
+        default:
+            obj = lv_table_create(parent);
+            lv_table_set_cell_value(obj, lv_test_rand(3), lv_test_rand(2), "x");
+            break;
+    }
+
+    if(lv_test_rand(2)) lv_obj_set_style_bg_color(obj, lv_color_hex(lv_test_rand(0x1000000)), 0);
+    if(lv_test_rand(3) == 0) lv_obj_set_style_radius(obj, lv_test_rand(10), LV_STATE_PRESSED);
+    lv_obj_set_pos(obj, lv_test_rand(LCD_WIDTH), lv_test_rand(LCD_HEIGHT));
+    return obj;
+}
+
+static void event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+static uint32_t heap_used(const lv_mem_monitor_t * mon)
+{
+    return mon->total_size - mon->free_size;
+}
@@ -0,0 +1,135 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file test_refr_direct.c
+ * Direct mode with two buffers (copy-forward of the areas redrawn in the previous frame)
+ * must show the same frames as full refresh.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CARD_CNT    6
+#define FRAME_CNT   2000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_test_disp_t disp;
+    lv_obj_t * tabview;
+    lv_obj_t * home;
+    lv_obj_t * cards[CARD_CNT];
+    lv_obj_t * labels[CARD_CNT];
+} ui_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void ui_create(ui_t * ui, bool full);
+static void ui_apply(ui_t * ui, uint32_t op, uint32_t card, uint32_t a, uint32_t b);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    static ui_t full;
+    static ui_t direct;
+    uint32_t frame;
+
+    lv_init();
+    ui_create(&full, true);
+    ui_create(&direct, false);
+
+    lv_test_srand(1);
+    for(frame = 0; frame < FRAME_CNT; frame++) {
+        /*A few changes per frame, the same on both displays*/
+        uint32_t changes = 1 + lv_test_rand(3);
+        while(changes--) {
+            uint32_t op = lv_test_rand(8);
+            uint32_t card = lv_test_rand(CARD_CNT);
+            uint32_t a = lv_test_rand(0);
+            uint32_t b = lv_test_rand(0);
+            ui_apply(&full, op, card, a, b);
+            ui_apply(&direct, op, card, a, b);
+        }
+
+        lv_test_run(LV_DISP_DEF_REFR_PERIOD);
+
+        LV_TEST_ASSERT_INT_EQ(full.disp.flushes, direct.disp.flushes);
+        if(memcmp(full.disp.shown, direct.disp.shown, LCD_WIDTH * LCD_HEIGHT * sizeof(lv_color_t)) != 0) {
+            fprintf(stderr, "frame %u differs from full refresh\n", (unsigned)frame);
+            return 1;
+        }
+    }
+
+    printf("test_refr_direct: %u frames identical to full refresh\n", (unsigned)FRAME_CNT);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void ui_create(ui_t * ui, bool full)
+{
+    uint32_t i;
+
+    lv_test_disp_init(&ui->disp, full);
+
+    ui->tabview = lv_tabview_create(lv_disp_get_scr_act(ui->disp.disp), LV_DIR_BOTTOM, 40);
+    ui->home = lv_tabview_add_tab(ui->tabview, "Home");
+    lv_tabview_add_tab(ui->tabview, "Info");
+
+    for(i = 0; i < CARD_CNT; i++) {
+        ui->cards[i] = lv_btn_create(ui->home);
+        lv_obj_set_size(ui->cards[i], 120, 80);
+        lv_obj_set_pos(ui->cards[i], (i % 3) * 140, (i / 3) * 100);
+        ui->labels[i] = lv_label_create(ui->cards[i]);
+        lv_label_set_text(ui->labels[i], "-");
+        lv_obj_center(ui->labels[i]);
+    }
+}
+
+static void ui_apply(ui_t * ui, uint32_t op, uint32_t card, uint32_t a, uint32_t b)
+{
+    switch(op) {
+        case 0:
+            lv_label_set_text_fmt(ui->labels[card], "val %u", (unsigned)(a % 1000));
+            break;
+        case 1:
+            lv_obj_set_pos(ui->cards[card], a % 360, b % 120);
+            break;
+        case 2:
+            if(a % 2) lv_obj_add_flag(ui->cards[card], LV_OBJ_FLAG_HIDDEN);
+            else lv_obj_clear_flag(ui->cards[card], LV_OBJ_FLAG_HIDDEN);
+            break;
+        case 3:
+            lv_obj_set_style_bg_color(ui->cards[card], lv_color_hex(a), 0);
+            break;
+        case 4:
+            lv_obj_set_size(ui->cards[card], 40 + a % 120, 30 + b % 80);
+            break;
+        case 5:
+            lv_obj_scroll_to(ui->home, a % 100, b % 100, LV_ANIM_OFF);
+            break;
+        case 6:
+            lv_obj_set_style_opa(ui->cards[card], a % 256, 0);
+            break;
+        default:
+            if(a % 16 == 0) lv_tabview_set_act(ui->tabview, b % 2, LV_ANIM_OFF);
+            break;
+    }
+}
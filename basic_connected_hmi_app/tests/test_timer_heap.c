@@ -0,0 +1,229 @@
+/*
+ *  Copyright 2024 NXP
+ *
+ *  SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @file test_timer_heap.c
+ * Random timer creations, deletions, pauses, resets and period changes, from the test and from
+ * the timer callbacks. After each `lv_timer_handler()` call the heap of the scheduled timers must
+ * be ordered by deadline, no timer may be overdue, none may have run twice and the returned delay
+ * must be the one of the earliest deadline.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_test.h"
+#include "src/misc/lv_gc.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ID_MAX      4096
+#define STEP_CNT    20000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_timer_t * timer;
+    uint32_t run_cnt;       /*Runs since the start*/
+    uint32_t call_run_cnt;  /*Runs in the current handler call*/
+} timer_state_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void run(uint32_t timer_cnt);
+static uint32_t timer_add(uint32_t period);
+static void timer_cb(lv_timer_t * timer);
+static void random_op(void);
+static void sync_alive(void);
+static void check(uint32_t step, uint32_t time_till_next);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static timer_state_t states[ID_MAX];
+static uint32_t id_cnt;
+static uint32_t run_total;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(void)
+{
+    lv_init();
+
+    run(10);
+    run(100);
+    run(1000);
+
+    printf("test_timer_heap: %u handler calls with 10, 100 and 1000 timers, %u runs, the heap stayed ordered\n",
+           (unsigned)STEP_CNT * 3, (unsigned)run_total);
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void run(uint32_t timer_cnt)
+{
+    uint32_t step;
+    uint32_t i;
+
+    lv_memset_00(states, sizeof(states));
+    id_cnt = 0;
+    lv_test_srand(timer_cnt);
+
+    for(i = 0; i < timer_cnt; i++) {
+        uint32_t id = timer_add(1 + lv_test_rand(200));
+        if(id % 9 == 0) lv_timer_set_repeat_count(states[id].timer, 1 + id % 4);
+    }
+
+    for(step = 0; step < STEP_CNT; step++) {
+        lv_tick_inc(lv_test_rand(20));
+        uint32_t op_cnt = lv_test_rand(4);
+        for(i = 0; i < op_cnt; i++) random_op();
+
+        for(i = 0; i < id_cnt; i++) states[i].call_run_cnt = 0;
+        uint32_t time_till_next = lv_timer_handler();
+        sync_alive();
+        check(step, time_till_next);
+    }
+
+    for(i = 0; i < id_cnt; i++) {
+        if(states[i].timer) lv_timer_del(states[i].timer);
+    }
+}
+
+static uint32_t timer_add(uint32_t period)
+{
+    uint32_t id = id_cnt++;
+    states[id].timer = lv_timer_create(timer_cb, period, (void *)(uintptr_t)id);
+    return id;
+}
+
+/*Changes the timer itself or creates new ones*/
+static void timer_cb(lv_timer_t * timer)
+{
+    uint32_t id = (uintptr_t)timer->user_data;
+    timer_state_t * state = &states[id];
+    state->run_cnt++;
+    state->call_run_cnt++;
+    run_total++;
+
+    uint32_t cnt = state->run_cnt;
+    if(id % 7 == 0 && cnt % 3 == 0) lv_timer_set_period(timer, 1 + (id * cnt) % 150);
+    if(id % 11 == 0 && cnt == 5) {
+        lv_timer_del(timer);
+        state->timer = NULL;
+        return;
+    }
+    if(id % 13 == 0 && cnt % 4 == 0) lv_timer_pause(timer);
+    if(id % 17 == 0 && cnt % 6 == 0 && id_cnt < ID_MAX) {
+        uint32_t new_id = timer_add(1 + (id_cnt * 31) % 120);
+        if(new_id % 5 == 0) lv_timer_set_repeat_count(states[new_id].timer, 2);
+    }
+    if(id % 19 == 0 && cnt % 5 == 0) lv_timer_reset(timer);
+}
+
+static void random_op(void)
+{
+    uint32_t id = lv_test_rand(id_cnt);
+    uint32_t op = lv_test_rand(8);
+    uint32_t arg = lv_test_rand(0);
+    lv_timer_t * timer = states[id].timer;
+
+    if(timer == NULL) {
+        if(op == 7 && id_cnt < ID_MAX) timer_add(1 + arg % 300);
+        return;
+    }
+
+    switch(op) {
+        case 0:
+            lv_timer_pause(timer);
+            break;
+        case 1:
+        case 2:
+            lv_timer_resume(timer);
+            break;
+        case 3:
+            lv_timer_ready(timer);
+            break;
+        case 4:
+            lv_timer_reset(timer);
+            break;
+        case 5:
+            lv_timer_set_period(timer, 1 + arg % 250);
+            break;
+        case 6:
+            if(arg % 2) {
+                lv_timer_del(timer);
+                states[id].timer = NULL;
+            }
+            else {
+                lv_timer_set_repeat_count(timer, 0);
+            }
+            break;
+        default:
+            lv_timer_set_repeat_count(timer, 1 + arg % 3);
+            break;
+    }
+}
+
+/*Forget the timers deleted by the handler at the end of their repeat count*/
+static void sync_alive(void)
+{
+    static bool alive[ID_MAX];
+    lv_timer_t * timer = NULL;
+    uint32_t i;
+
+    lv_memset_00(alive, sizeof(alive));
+    while((timer = lv_timer_get_next(timer)) != NULL) {
+        if(timer->timer_cb == timer_cb) alive[(uintptr_t)timer->user_data] = true;
+    }
+    for(i = 0; i < id_cnt; i++) {
+        if(!alive[i]) states[i].timer = NULL;
+    }
+}
+
+static void check(uint32_t step, uint32_t time_till_next)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    uint32_t scheduled_cnt = 0;
+    uint32_t earliest = LV_NO_TIMER_READY;
+    lv_timer_t * timer = NULL;
+    uint32_t i;
+
+    while((timer = lv_timer_get_next(timer)) != NULL) {
+        if(!timer->paused) scheduled_cnt++;
+    }
+
+    while((timer = lv_timer_get_next(timer)) != NULL) {
+        if(timer->paused) continue;
+
+        /*Every not paused timer is in the heap once, and not before its parent*/
+        if(timer->heap_idx >= scheduled_cnt || heap[timer->heap_idx] != timer) {
+            fprintf(stderr, "step %u: timer %u is not at its heap index\n", (unsigned)step,
+                    (unsigned)(uintptr_t)timer->user_data);
+            exit(1);
+        }
+        if(timer->heap_idx > 0) {
+            lv_timer_t * parent = heap[(timer->heap_idx - 1) / 2];
+            LV_TEST_ASSERT((int32_t)((timer->last_run + timer->period) - (parent->last_run + parent->period)) >= 0);
+        }
+
+        /*The ready timers ran*/
+        uint32_t elapsed = lv_tick_elaps(timer->last_run);
+        LV_TEST_ASSERT(elapsed < timer->period);
+        earliest = LV_MIN(earliest, timer->period - elapsed);
+    }
+
+    LV_TEST_ASSERT_INT_EQ(earliest, time_till_next);
+    for(i = 0; i < id_cnt; i++) LV_TEST_ASSERT(states[i].call_run_cnt <= 1);
+}